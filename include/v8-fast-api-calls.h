@@ -152,11 +152,16 @@
  *   - bool
  *   - int32_t
  *   - uint32_t
+ *   - int64_t (64-bit targets only)
+ *   - uint64_t (64-bit targets only)
  *   - float32_t
  *   - float64_t
  * Currently supported argument types:
  *  - pointer to an embedder type
  *  - JavaScript array of primitive types
+ *  - TypedArrays of uint8_t, int32_t, uint32_t, int64_t, uint64_t,
+ *    float32_t and float64_t (see FastApiTypedArray)
+ *  - flat sequential one-byte strings (see FastOneByteString)
  *  - bool
  *  - int32_t
  *  - uint32_t
@@ -168,7 +173,9 @@
  * The 64-bit integer types currently have the IDL (unsigned) long long
  * semantics: https://heycam.github.io/webidl/#abstract-opdef-converttoint
  * In the future we'll extend the API to also provide conversions from/to
- * BigInt to preserve full precision.
+ * BigInt to preserve full precision. 64-bit integer return values are
+ * converted to a JavaScript Number, so values outside of the safe integer
+ * range lose precision.
  * The floating point types currently have the IDL (unrestricted) semantics,
  * which is the only one used by WebGL. We plan to add support also for
  * restricted floats/doubles, similarly to the BigInt conversion policies.
@@ -177,7 +184,7 @@
  * passes NaN values as-is, i.e. doesn't normalize them.
  *
  * To be supported types:
- *  - TypedArrays and ArrayBuffers
+ *  - ArrayBuffers
  *  - arrays of embedder types
  *
  *
@@ -240,6 +247,7 @@ class CTypeInfo {
   enum class Type : uint8_t {
     kVoid,
     kBool,
+    kUint8,
     kInt32,
     kUint32,
     kInt64,
@@ -247,6 +255,7 @@ class CTypeInfo {
     kFloat32,
     kFloat64,
     kV8Value,
+    kSeqOneByteString,
     kApiObject,  // This will be deprecated once all users have
                  // migrated from v8::ApiObject to v8::Local<v8::Value>.
     kAny,        // This is added to enable untyped representation of fast
@@ -302,8 +311,9 @@ class CTypeInfo {
   constexpr Flags GetFlags() const { return flags_; }
 
   static constexpr bool IsIntegralType(Type type) {
-    return type == Type::kInt32 || type == Type::kUint32 ||
-           type == Type::kInt64 || type == Type::kUint64;
+    return type == Type::kUint8 || type == Type::kInt32 ||
+           type == Type::kUint32 || type == Type::kInt64 ||
+           type == Type::kUint64;
   }
 
   static constexpr bool IsFloatingPointType(Type type) {
@@ -377,6 +387,16 @@ struct FastApiArrayBuffer {
   size_t byte_length;
 };
 
+// A flat sequential one-byte string. The characters are Latin-1 encoded and
+// not null-terminated. {data} points directly into the JavaScript heap, so it
+// is only valid for the duration of the fast call and must not be retained.
+// Strings of any other representation (two-byte, cons, sliced, external, ...)
+// take the slow path.
+struct FastOneByteString {
+  const char* data;
+  uint32_t length;
+};
+
 class V8_EXPORT CFunctionInfo {
  public:
   // Construct a struct to hold a CFunction's type information.
@@ -429,12 +449,14 @@ struct AnyCType {
     double double_value;
     Local<Object> object_value;
     Local<Array> sequence_value;
+    const FastApiTypedArray<uint8_t>* uint8_ta_value;
     const FastApiTypedArray<int32_t>* int32_ta_value;
     const FastApiTypedArray<uint32_t>* uint32_ta_value;
     const FastApiTypedArray<int64_t>* int64_ta_value;
     const FastApiTypedArray<uint64_t>* uint64_ta_value;
     const FastApiTypedArray<float>* float_ta_value;
     const FastApiTypedArray<double>* double_ta_value;
+    const FastOneByteString* string_value;
     FastApiCallbackOptions* options_value;
   };
 };
@@ -607,10 +629,12 @@ class CFunctionInfoImpl : public CFunctionInfo {
                       kReturnType == CTypeInfo::Type::kBool ||
                       kReturnType == CTypeInfo::Type::kInt32 ||
                       kReturnType == CTypeInfo::Type::kUint32 ||
+                      kReturnType == CTypeInfo::Type::kInt64 ||
+                      kReturnType == CTypeInfo::Type::kUint64 ||
                       kReturnType == CTypeInfo::Type::kFloat32 ||
                       kReturnType == CTypeInfo::Type::kFloat64 ||
                       kReturnType == CTypeInfo::Type::kAny,
-                  "64-bit int and api object values are not currently "
+                  "String and api object values are not currently "
                   "supported return types.");
   }
 
@@ -655,12 +679,13 @@ struct CTypeInfoTraits {};
   V(double, kFloat64)
 
 // Same as above, but includes deprecated types for compatibility.
-#define ALL_C_TYPES(V)               \
-  PRIMITIVE_C_TYPES(V)               \
-  V(void, kVoid)                     \
-  V(v8::Local<v8::Value>, kV8Value)  \
-  V(v8::Local<v8::Object>, kV8Value) \
-  V(ApiObject, kApiObject)           \
+#define ALL_C_TYPES(V)                           \
+  PRIMITIVE_C_TYPES(V)                           \
+  V(void, kVoid)                                 \
+  V(v8::Local<v8::Value>, kV8Value)              \
+  V(v8::Local<v8::Object>, kV8Value)             \
+  V(const FastOneByteString&, kSeqOneByteString) \
+  V(ApiObject, kApiObject)                       \
   V(AnyCType, kAny)
 
 // ApiObject was a temporary solution to wrap the pointer to the v8::Value.
@@ -687,6 +712,7 @@ PRIMITIVE_C_TYPES(DEFINE_TYPE_INFO_TRAITS)
   };
 
 #define TYPED_ARRAY_C_TYPES(V) \
+  V(uint8_t, kUint8)           \
   V(int32_t, kInt32)           \
   V(uint32_t, kUint32)         \
   V(int64_t, kInt64)           \
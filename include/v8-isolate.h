@@ -794,6 +794,31 @@ class V8_EXPORT Isolate {
       std::unique_ptr<MeasureMemoryDelegate> delegate,
       MeasureMemoryExecution execution = MeasureMemoryExecution::kDefault);
 
+  /**
+   * This API is experimental and may change significantly.
+   *
+   * Enables or disables continuous memory measurement. While enabled, every
+   * full garbage collection attributes the live heap bytes to the native
+   * contexts of the isolate as part of (concurrent) marking. The measurement
+   * never triggers a garbage collection on its own. Contexts created after
+   * enabling are measured starting with the second full garbage collection
+   * after their creation.
+   */
+  void SetContinuousMemoryMeasurement(bool enabled);
+
+  /**
+   * Retrieves the live bytes attributed to the given context by the most
+   * recent full garbage collection with continuous memory measurement.
+   * Returns false if the context has not been measured yet.
+   */
+  bool GetMeasuredContextMemory(Local<Context> context, size_t* size_in_bytes);
+
+  /**
+   * Returns the live bytes that the most recent continuous memory measurement
+   * could not attribute to a single context.
+   */
+  size_t GetMeasuredSharedMemory();
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -52,6 +52,10 @@ struct GarbageCollectionFullCycle {
   double efficiency_cpp_in_bytes_per_us = -1.0;
   double main_thread_efficiency_in_bytes_per_us = -1.0;
   double main_thread_efficiency_cpp_in_bytes_per_us = -1.0;
+  // Only set if incremental marking was scheduled for a pause-time target.
+  int64_t atomic_pause_target_in_us = -1;
+  // Duration by which the atomic pause exceeded the target; 0 if it was met.
+  int64_t atomic_pause_target_overshoot_in_us = -1;
 };
 
 struct GarbageCollectionFullMainThreadIncrementalMark {
@@ -920,6 +920,35 @@ class V8_EXPORT HeapProfiler {
       bool treat_global_objects_as_roots = true,
       bool capture_numeric_value = false);
 
+  /**
+   * Takes a heap snapshot and writes it to |stream| while it is being taken.
+   * Unlike TakeHeapSnapshot(), edges are written as soon as they are found
+   * and are not kept in memory, and no HeapSnapshot is retained. |stream| must
+   * not call into V8. Returns false if the snapshot was aborted by |control|
+   * or |stream|.
+   *
+   * The output is a sequence of lines. The first line is a JSON object
+   * describing the fields of all record types. Every following line is a
+   * JSON array holding a single record, with the record type as its first
+   * element:
+   *
+   *   [0, id, "value"]          string
+   *   [1, type, name, id, self_size, edge_count, trace_node_id,
+   *    detachedness]            node
+   *   [2, from_node, type, name_or_index, to_node]  edge
+   *   [3, node, script_id, line, column]            location
+   *
+   * Nodes are referenced by their SnapshotObjectId. Strings are referenced by
+   * id and appear before the first record that uses them. Edges are written
+   * first, followed by nodes and locations. Allocation traces are not
+   * included.
+   */
+  bool TakeStreamingHeapSnapshot(
+      OutputStream* stream, ActivityControl* control = nullptr,
+      ObjectNameResolver* global_object_name_resolver = nullptr,
+      bool treat_global_objects_as_roots = true,
+      bool capture_numeric_value = false);
+
   /**
    * Starts tracking of heap objects population statistics. After calling
    * this method, all heap objects relocations done by the garbage collector
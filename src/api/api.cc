@@ -66,6 +66,7 @@
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier.h"
+#include "src/heap/memory-measurement.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/icu_util.h"
@@ -669,6 +670,13 @@ StartupData SnapshotCreator::CreateBlob(
   // We might rehash strings and re-sort descriptors. Clear the lookup cache.
   isolate->descriptor_lookup_cache()->Clear();
 
+  // Feedback is cleared below, so record the functions that got hot before
+  // that happens.
+  if (i::FLAG_snapshot_tiering_hints &&
+      function_code_handling == FunctionCodeHandling::kKeep) {
+    i::Snapshot::RecordTieringHintsForSerialization(isolate);
+  }
+
   // If we don't do this then we end up with a stray root pointing at the
   // context even after we have disposed of the context.
   isolate->heap()->CollectAllAvailableGarbage(
@@ -6047,6 +6055,8 @@ void v8::Object::SetAlignedPointerInInternalField(int index, void* value) {
                   location, "Unaligned pointer");
   DCHECK_EQ(value, GetAlignedPointerFromInternalField(index));
   internal::WriteBarrier::MarkingFromInternalFields(i::JSObject::cast(*obj));
+  internal::WriteBarrier::GenerationalFromInternalFields(
+      i::JSObject::cast(*obj));
 }
 
 void v8::Object::SetAlignedPointerInInternalFields(int argc, int indices[],
@@ -6069,6 +6079,7 @@ void v8::Object::SetAlignedPointerInInternalFields(int argc, int indices[],
     DCHECK_EQ(value, GetAlignedPointerFromInternalField(index));
   }
   internal::WriteBarrier::MarkingFromInternalFields(js_obj);
+  internal::WriteBarrier::GenerationalFromInternalFields(js_obj);
 }
 
 static void* ExternalValue(i::Object obj) {
@@ -8718,8 +8729,14 @@ void Isolate::Initialize(Isolate* isolate,
   }
 
   if (params.experimental_attach_to_shared_isolate != nullptr) {
-    i_isolate->set_shared_isolate(reinterpret_cast<i::Isolate*>(
-        params.experimental_attach_to_shared_isolate));
+    i::Isolate* shared_isolate = reinterpret_cast<i::Isolate*>(
+        params.experimental_attach_to_shared_isolate);
+    // The shared heap is only reachable from its own pointer compression
+    // cage. IsolateAllocator places Isolates into the cage of the shared
+    // Isolate while it exists.
+    CHECK_IMPLIES(COMPRESS_POINTERS_IN_SHARED_CAGE_BOOL,
+                  i_isolate->cage_base() == shared_isolate->cage_base());
+    i_isolate->set_shared_isolate(shared_isolate);
   }
 
   // TODO(jochen): Once we got rid of Isolate::Current(), we can remove this.
@@ -9091,6 +9108,26 @@ bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
   return isolate->heap()->MeasureMemory(std::move(delegate), execution);
 }
 
+void Isolate::SetContinuousMemoryMeasurement(bool enabled) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  isolate->heap()->memory_measurement()->SetContinuousMode(enabled);
+}
+
+bool Isolate::GetMeasuredContextMemory(Local<Context> context,
+                                       size_t* size_in_bytes) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::NativeContext native_context =
+      Utils::OpenHandle(*context)->native_context();
+  return isolate->heap()->memory_measurement()->GetContinuousResult(
+      native_context, size_in_bytes);
+}
+
+size_t Isolate::GetMeasuredSharedMemory() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  return isolate->heap()->memory_measurement()->continuous_shared_size();
+}
+
 std::unique_ptr<MeasureMemoryDelegate> MeasureMemoryDelegate::Default(
     Isolate* isolate, Local<Context> context,
     Local<Promise::Resolver> promise_resolver, MeasureMemoryMode mode) {
@@ -10272,6 +10309,15 @@ const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(
           capture_numeric_value));
 }
 
+bool HeapProfiler::TakeStreamingHeapSnapshot(
+    OutputStream* stream, ActivityControl* control,
+    ObjectNameResolver* resolver, bool treat_global_objects_as_roots,
+    bool capture_numeric_value) {
+  return reinterpret_cast<i::HeapProfiler*>(this)->TakeStreamingSnapshot(
+      stream, control, resolver, treat_global_objects_as_roots,
+      capture_numeric_value);
+}
+
 void HeapProfiler::StartTrackingHeapObjects(bool track_allocations) {
   reinterpret_cast<i::HeapProfiler*>(this)->StartHeapObjectsTracking(
       track_allocations);
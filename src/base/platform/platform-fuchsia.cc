@@ -245,6 +245,9 @@ bool OS::FreeAddressSpaceReservation(AddressSpaceReservation reservation) {
 // static
 bool OS::HasLazyCommits() { return true; }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 std::vector<OS::SharedLibraryAddress> OS::GetSharedLibraryAddresses() {
   UNREACHABLE();  // TODO(scottmg): Port, https://crbug.com/731217.
 }
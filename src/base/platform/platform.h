@@ -211,6 +211,10 @@ class V8_BASE_EXPORT OS {
 
   static bool HasLazyCommits();
 
+  // Asks the OS to back the given region with transparent huge pages once it
+  // is committed. Returns false if this is not supported.
+  static bool AdviseHugePages(void* address, size_t size);
+
   // Sleep for a specified time interval.
   static void Sleep(TimeDelta interval);
 
@@ -45,6 +45,7 @@
 #include "src/heap/local-heap.h"
 #include "src/heap/parked-scope.h"
 #include "src/init/bootstrapper.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log-inl.h"
@@ -881,6 +882,12 @@ void InsertCodeIntoOptimizedCodeCache(
   const CodeKind kind = compilation_info->code_kind();
   if (!CodeKindIsStoredInOptimizedCodeCache(kind)) return;
 
+  if (FLAG_code_cache_tiering_hints) {
+    // Remember the function as hot. The flag is serialized along with the
+    // function into the code cache and speeds up tier-up in later runs.
+    compilation_info->shared_info()->set_is_known_hot(true);
+  }
+
   if (compilation_info->function_context_specializing()) {
     // Function context specialization folds-in the function context, so no
     // sharing can occur. Make sure the optimized code cache is cleared.
@@ -995,7 +1002,10 @@ bool GetOptimizedCodeLater(std::unique_ptr<OptimizedCompilationJob> job,
     PrintF(" for concurrent optimization.\n");
   }
 
-  if (CodeKindIsStoredInOptimizedCodeCache(code_kind)) {
+  // OSR jobs don't replace the function's code, so the function itself is not
+  // considered to be in the optimization queue.
+  if (CodeKindIsStoredInOptimizedCodeCache(code_kind) &&
+      !compilation_info->is_osr()) {
     function->SetOptimizationMarker(OptimizationMarker::kInOptimizationQueue);
   }
 
@@ -1090,6 +1100,19 @@ MaybeHandle<CodeT> GetOptimizedCode(
     }
   }
 
+  // Don't queue a second concurrent OSR job for the same loop. Once the
+  // pending one is finalized, the loop picks its code up from the cache.
+  if (mode == ConcurrencyMode::kConcurrent && !osr_offset.IsNone() &&
+      isolate->optimizing_compile_dispatcher()->HasPendingOsrJob(*function,
+                                                                 osr_offset)) {
+    if (FLAG_trace_concurrent_recompilation) {
+      PrintF("  ** OSR of ");
+      function->ShortPrint();
+      PrintF(" at offset %d is already queued.\n", osr_offset.ToInt());
+    }
+    return {};
+  }
+
   // Reset profiler ticks, function is no longer considered hot.
   DCHECK(shared->is_compiled());
   function->feedback_vector().set_profiler_ticks(0);
@@ -1118,6 +1141,9 @@ MaybeHandle<CodeT> GetOptimizedCode(
   if (mode == ConcurrencyMode::kConcurrent) {
     if (GetOptimizedCodeLater(std::move(job), isolate, compilation_info,
                               code_kind, function)) {
+      // Concurrent OSR keeps running in the unoptimized frame; the result is
+      // picked up from the OSR code cache after finalization.
+      if (!osr_offset.IsNone()) return {};
       return ContinuationForConcurrentOptimization(isolate, function);
     }
   } else {
@@ -3222,11 +3248,14 @@ template Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfo(
 // static
 MaybeHandle<CodeT> Compiler::GetOptimizedCodeForOSR(
     Isolate* isolate, Handle<JSFunction> function, BytecodeOffset osr_offset,
-    JavaScriptFrame* osr_frame) {
+    JavaScriptFrame* osr_frame, ConcurrencyMode mode) {
   DCHECK(!osr_offset.IsNone());
   DCHECK_NOT_NULL(osr_frame);
-  return GetOptimizedCode(isolate, function, ConcurrencyMode::kNotConcurrent,
-                          CodeKindForOSR(), osr_offset, osr_frame);
+  // The frame does not outlive this call, so concurrent jobs must not keep a
+  // pointer to it.
+  if (mode == ConcurrencyMode::kConcurrent) osr_frame = nullptr;
+  return GetOptimizedCode(isolate, function, mode, CodeKindForOSR(),
+                          osr_offset, osr_frame);
 }
 
 // static
@@ -3268,8 +3297,23 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
       if (V8_LIKELY(use_result)) {
         InsertCodeIntoOptimizedCodeCache(compilation_info);
         CompilerTracer::TraceCompletedJob(isolate, compilation_info);
-        compilation_info->closure()->set_code(*compilation_info->code(),
-                                              kReleaseStore);
+        if (compilation_info->is_osr()) {
+          // Re-arm the back edge of the compiled loop so that its next
+          // iteration enters the runtime and picks the code up from the OSR
+          // code cache. This also arms the enclosing loops, but not the loops
+          // nested inside of it.
+          Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(isolate),
+                                         isolate);
+          interpreter::BytecodeArrayIterator it(
+              bytecode, compilation_info->osr_offset().ToInt());
+          DCHECK_EQ(it.current_bytecode(), interpreter::Bytecode::kJumpLoop);
+          int loop_depth = it.GetImmediateOperand(1);
+          bytecode->set_osr_loop_nesting_level(
+              std::max(bytecode->osr_loop_nesting_level(), loop_depth + 1));
+        } else {
+          compilation_info->closure()->set_code(*compilation_info->code(),
+                                                kReleaseStore);
+        }
       }
       return CompilationJob::SUCCEEDED;
     }
@@ -3277,7 +3321,7 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
 
   DCHECK_EQ(job->state(), CompilationJob::State::kFailed);
   CompilerTracer::TraceAbortedJob(isolate, compilation_info);
-  if (V8_LIKELY(use_result)) {
+  if (V8_LIKELY(use_result) && !compilation_info->is_osr()) {
     compilation_info->closure()->set_code(shared->GetCode(), kReleaseStore);
     // Clear the InOptimizationQueue marker, if it exists.
     if (compilation_info->closure()->IsInOptimizationQueue()) {
@@ -234,9 +234,12 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   // instead of generating JIT code for a function at all.
 
   // Generate and return optimized code for OSR, or empty handle on failure.
+  // In concurrent mode the job is queued and an empty handle is returned; once
+  // finalized, the code is put into the OSR code cache and picked up by the
+  // next OSR request for the same loop.
   V8_WARN_UNUSED_RESULT static MaybeHandle<CodeT> GetOptimizedCodeForOSR(
       Isolate* isolate, Handle<JSFunction> function, BytecodeOffset osr_offset,
-      JavaScriptFrame* osr_frame);
+      JavaScriptFrame* osr_frame, ConcurrencyMode mode);
 };
 
 // A base class for compilation jobs intended to run concurrent to the main
@@ -1475,6 +1475,11 @@ class V8_EXPORT_PRIVATE Assembler : public AssemblerBase {
   SSE2_INSTRUCTION_LIST_SHIFT_IMM(AVX_SSE2_SHIFT_IMM)
 #undef AVX_SSE2_SHIFT_IMM
 
+  void vpsrldq(XMMRegister dst, XMMRegister src, uint8_t imm8) {
+    vinstr(0x73, xmm3, dst, src, k66, k0F, kWIG);
+    emit(imm8);
+  }
+
   void vmovlhps(XMMRegister dst, XMMRegister src1, XMMRegister src2) {
     vinstr(0x16, dst, src1, src2, kNoPrefix, k0F, kWIG);
   }
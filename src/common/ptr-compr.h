@@ -15,6 +15,18 @@ namespace internal {
 // See v8:7703 for details about how pointer compression works.
 constexpr size_t kPtrComprCageReservationSize = size_t{4} * GB;
 constexpr size_t kPtrComprCageBaseAlignment = size_t{4} * GB;
+constexpr int kPtrComprCageBaseAlignmentLog2 = 32;
+static_assert(size_t{1} << kPtrComprCageBaseAlignmentLog2 ==
+                  kPtrComprCageBaseAlignment,
+              "Cage base alignment must match its log2");
+
+// Upper bound for --shared-ptr-compr-cages.
+constexpr int kMaxSharedPtrComprCages = 16;
+// The process-wide cages are looked up by the bits of their base above the
+// cage alignment. Cages must lie within the lower 2^48 bytes of the address
+// space for that.
+constexpr size_t kSharedPtrComprCageIndexTableSize =
+    size_t{1} << (48 - kPtrComprCageBaseAlignmentLog2);
 
 }  // namespace internal
 }  // namespace v8
@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -26,7 +28,9 @@ namespace {
 
 void DisposeCompilationJob(OptimizedCompilationJob* job,
                            bool restore_function_code) {
-  if (restore_function_code) {
+  // OSR jobs never replaced the function's code, so there is nothing to
+  // restore.
+  if (restore_function_code && !job->compilation_info()->is_osr()) {
     Handle<JSFunction> function = job->compilation_info()->closure();
     function->set_code(function->shared().GetCode(), kReleaseStore);
     if (function->IsInOptimizationQueue()) {
@@ -137,6 +141,7 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
       output_queue_.pop();
     }
 
+    RemovePendingOsrJob(job);
     DisposeCompilationJob(job, restore_function_code);
   }
 }
@@ -148,6 +153,7 @@ void OptimizingCompileDispatcher::FlushInputQueue() {
     DCHECK_NOT_NULL(job);
     input_queue_shift_ = InputQueueIndex(1);
     input_queue_length_--;
+    RemovePendingOsrJob(job);
     DisposeCompilationJob(job, true);
   }
 }
@@ -203,9 +209,10 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
       job = output_queue_.front();
       output_queue_.pop();
     }
+    RemovePendingOsrJob(job);
     OptimizedCompilationInfo* info = job->compilation_info();
     Handle<JSFunction> function(*info->closure(), isolate_);
-    if (function->HasAvailableCodeKind(info->code_kind())) {
+    if (!info->is_osr() && function->HasAvailableCodeKind(info->code_kind())) {
       if (FLAG_trace_concurrent_recompilation) {
         PrintF("  ** Aborting compilation for ");
         function->ShortPrint();
@@ -226,9 +233,34 @@ bool OptimizingCompileDispatcher::HasJobs() {
   return ref_count_ != 0 || !output_queue_.empty();
 }
 
+bool OptimizingCompileDispatcher::HasPendingOsrJob(JSFunction function,
+                                                   BytecodeOffset osr_offset) {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  for (OptimizedCompilationJob* job : pending_osr_jobs_) {
+    OptimizedCompilationInfo* info = job->compilation_info();
+    if (*info->closure() != function) continue;
+    if (osr_offset.IsNone() || info->osr_offset() == osr_offset) return true;
+  }
+  return false;
+}
+
+void OptimizingCompileDispatcher::RemovePendingOsrJob(
+    OptimizedCompilationJob* job) {
+  if (!job->compilation_info()->is_osr()) return;
+  auto it = std::find(pending_osr_jobs_.begin(), pending_osr_jobs_.end(), job);
+  DCHECK(it != pending_osr_jobs_.end());
+  pending_osr_jobs_.erase(it);
+}
+
 void OptimizingCompileDispatcher::QueueForOptimization(
     OptimizedCompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  OptimizedCompilationInfo* info = job->compilation_info();
+  if (info->is_osr()) {
+    // Compiling the same loop twice would only waste a worker thread.
+    DCHECK(!HasPendingOsrJob(*info->closure(), info->osr_offset()));
+    pending_osr_jobs_.push_back(job);
+  }
   {
     // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
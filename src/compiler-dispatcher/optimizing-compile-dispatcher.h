@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <queue>
+#include <vector>
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
@@ -14,10 +15,12 @@
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/utils/allocation.h"
+#include "src/utils/utils.h"
 
 namespace v8 {
 namespace internal {
 
+class JSFunction;
 class LocalHeap;
 class OptimizedCompilationJob;
 class RuntimeCallStats;
@@ -54,6 +57,12 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // This method must be called on the main thread.
   bool HasJobs();
 
+  // Whether an OSR job for {function} at {osr_offset} (or at any offset if
+  // {osr_offset} is none) has been queued and not yet been installed or
+  // disposed. This method must be called on the main thread.
+  bool HasPendingOsrJob(JSFunction function,
+                        BytecodeOffset osr_offset = BytecodeOffset::None());
+
   // Whether to finalize and thus install the optimized code.  Defaults to true.
   // Only set to false for testing (where finalization is then manually
   // requested using %FinalizeOptimization).
@@ -74,6 +83,7 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(OptimizedCompilationJob* job, LocalIsolate* local_isolate);
   OptimizedCompilationJob* NextInput(LocalIsolate* local_isolate);
+  void RemovePendingOsrJob(OptimizedCompilationJob* job);
 
   inline int InputQueueIndex(int i) {
     int result = (i + input_queue_shift_) % input_queue_capacity_;
@@ -97,6 +107,10 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // different threads.
   base::Mutex output_queue_mutex_;
 
+  // OSR jobs which are in one of the queues or being compiled. Only accessed
+  // on the main thread.
+  std::vector<OptimizedCompilationJob*> pending_osr_jobs_;
+
   std::atomic<int> ref_count_;
   base::Mutex ref_count_mutex_;
   base::ConditionVariable ref_count_zero_;
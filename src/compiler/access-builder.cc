@@ -8,6 +8,7 @@
 #include "src/execution/frames.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/heap.h"
+#include "src/objects/allocation-site.h"
 #include "src/objects/arguments.h"
 #include "src/objects/cell.h"
 #include "src/objects/contexts.h"
@@ -48,6 +49,18 @@ FieldAccess AccessBuilder::ForHeapNumberValue() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForAllocationSitePretenureCreateCount() {
+  FieldAccess access = {kTaggedBase,
+                        AllocationSite::kPretenureCreateCountOffset,
+                        MaybeHandle<Name>(),
+                        MaybeHandle<Map>(),
+                        TypeCache::Get()->kInt32,
+                        MachineType::Int32(),
+                        kNoWriteBarrier};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForBigIntBitfield() {
   FieldAccess access = {
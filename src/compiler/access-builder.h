@@ -36,6 +36,9 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to HeapNumber::value() field.
   static FieldAccess ForHeapNumberValue();
 
+  // Provides access to AllocationSite::pretenure_create_count() field.
+  static FieldAccess ForAllocationSitePretenureCreateCount();
+
   // Provides access to BigInt's bit field.
   static FieldAccess ForBigIntBitfield();
 
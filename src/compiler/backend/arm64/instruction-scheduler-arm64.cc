@@ -371,8 +371,9 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for arm64 instructions. They have been determined
-  // in an empirical way.
+  // Latencies model recent out-of-order cores (Neoverse N1 and V1 class),
+  // based on the published software optimization guides. Division and square
+  // root are data dependent and use typical rather than worst case values.
   switch (instr->arch_opcode()) {
     case kArm64Add:
     case kArm64Add32:
@@ -399,7 +400,8 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Tst:
     case kArm64Tst32:
       if (instr->addressing_mode() != kMode_None) {
-        return 3;
+        // Shifted or extended register operand.
+        return 2;
       } else {
         return 1;
       }
@@ -429,6 +431,9 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64LdrDecompressTaggedSigned:
     case kArm64LdrDecompressTaggedPointer:
     case kArm64LdrDecompressAnyTagged:
+      // Load followed by an add of the cage base.
+      return 5;
+
     case kArm64Ldr:
     case kArm64LdrD:
     case kArm64LdrS:
@@ -438,7 +443,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Ldrsb:
     case kArm64Ldrsh:
     case kArm64Ldrsw:
-      return 11;
+      return 4;
 
     case kArm64Str:
     case kArm64StrD:
@@ -452,13 +457,13 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Mneg32:
     case kArm64Msub32:
     case kArm64Mul32:
-      return 3;
+      return 2;
 
     case kArm64Madd:
     case kArm64Mneg:
     case kArm64Msub:
     case kArm64Mul:
-      return 5;
+      return 3;
 
     case kArm64Idiv32:
     case kArm64Udiv32:
@@ -472,23 +477,35 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Float32Sub:
     case kArm64Float64Add:
     case kArm64Float64Sub:
-      return 5;
-
     case kArm64Float32Abs:
     case kArm64Float32Cmp:
     case kArm64Float32Neg:
     case kArm64Float64Abs:
     case kArm64Float64Cmp:
     case kArm64Float64Neg:
+    case kArm64Float32Max:
+    case kArm64Float32Min:
+    case kArm64Float64Max:
+    case kArm64Float64Min:
+      return 2;
+
+    case kArm64Float32Mul:
+    case kArm64Float64Mul:
+    case kArm64Float32Fnmul:
+    case kArm64Float64Fnmul:
       return 3;
 
     case kArm64Float32Div:
+      return 10;
+
     case kArm64Float32Sqrt:
-      return 12;
+      return 11;
 
     case kArm64Float64Div:
+      return 15;
+
     case kArm64Float64Sqrt:
-      return 19;
+      return 17;
 
     case kArm64Float32RoundDown:
     case kArm64Float32RoundTiesEven:
@@ -499,7 +516,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Float64RoundTiesEven:
     case kArm64Float64RoundTruncate:
     case kArm64Float64RoundUp:
-      return 5;
+      return 3;
 
     case kArm64Float32ToFloat64:
     case kArm64Float64ToFloat32:
@@ -7,6 +7,7 @@
 #include "src/base/iterator.h"
 #include "src/base/optional.h"
 #include "src/base/utils/random-number-generator.h"
+#include "src/codegen/register-configuration.h"
 
 namespace v8 {
 namespace internal {
@@ -28,11 +29,18 @@ InstructionScheduler::ScheduleGraphNode*
 InstructionScheduler::CriticalPathFirstQueue::PopBestCandidate(int cycle) {
   DCHECK(!IsEmpty());
   auto candidate = nodes_.end();
+  const bool under_register_pressure = scheduler_->IsUnderRegisterPressure();
   for (auto iterator = nodes_.begin(); iterator != nodes_.end(); ++iterator) {
     // We only consider instructions that have all their operands ready.
-    if (cycle >= (*iterator)->start_cycle()) {
+    if (cycle < (*iterator)->start_cycle()) continue;
+    if (candidate == nodes_.end()) {
+      candidate = iterator;
+      if (!under_register_pressure) break;
+    } else if ((*iterator)->RegisterPressureDelta() <
+               (*candidate)->RegisterPressureDelta()) {
+      // Nodes are sorted by total latency, so among the candidates with the
+      // same effect on register pressure we keep the most critical one.
       candidate = iterator;
-      break;
     }
   }
 
@@ -62,6 +70,8 @@ InstructionScheduler::ScheduleGraphNode::ScheduleGraphNode(Zone* zone,
     : instr_(instr),
       successors_(zone),
       unscheduled_predecessors_count_(0),
+      operand_producers_(zone),
+      unscheduled_uses_count_(0),
       latency_(GetInstructionLatency(instr)),
       total_latency_(-1),
       start_cycle_(-1) {}
@@ -72,6 +82,17 @@ void InstructionScheduler::ScheduleGraphNode::AddSuccessor(
   node->unscheduled_predecessors_count_++;
 }
 
+int InstructionScheduler::ScheduleGraphNode::RegisterPressureDelta() const {
+  int delta = HasUnscheduledUse() ? 1 : 0;
+  for (ScheduleGraphNode* producer : operand_producers_) {
+    // This is the last use of the producer's value. Producers used several
+    // times by this node are not recognized, which only makes the estimate
+    // conservative.
+    if (producer->unscheduled_uses_count_ == 1) delta--;
+  }
+  return delta;
+}
+
 InstructionScheduler::InstructionScheduler(Zone* zone,
                                            InstructionSequence* sequence)
     : zone_(zone),
@@ -81,7 +102,10 @@ InstructionScheduler::InstructionScheduler(Zone* zone,
       pending_loads_(zone),
       last_live_in_reg_marker_(nullptr),
       last_deopt_or_trap_(nullptr),
-      operands_map_(zone) {
+      operands_map_(zone),
+      live_values_count_(0),
+      register_pressure_limit_(RegisterConfiguration::Default()
+                                   ->num_allocatable_general_registers()) {
   if (FLAG_turbo_stress_instruction_scheduling) {
     random_number_generator_ =
         base::Optional<base::RandomNumberGenerator>(FLAG_random_seed);
@@ -188,6 +212,7 @@ void InstructionScheduler::AddInstruction(Instruction* instr) {
         auto it = operands_map_.find(vreg);
         if (it != operands_map_.end()) {
           it->second->AddSuccessor(new_node);
+          new_node->AddOperandProducer(it->second);
         }
       }
     }
@@ -230,6 +255,13 @@ void InstructionScheduler::Schedule() {
     if (candidate != nullptr) {
       sequence()->AddInstruction(candidate->instruction());
 
+      // Update the number of live values.
+      for (ScheduleGraphNode* producer : candidate->operand_producers()) {
+        producer->DropUnscheduledUse();
+        if (!producer->HasUnscheduledUse()) live_values_count_--;
+      }
+      if (candidate->HasUnscheduledUse()) live_values_count_++;
+
       for (ScheduleGraphNode* successor : candidate->successors()) {
         successor->DropUnscheduledPredecessor();
         successor->set_start_cycle(
@@ -245,6 +277,7 @@ void InstructionScheduler::Schedule() {
   }
 
   // Reset own state.
+  DCHECK_EQ(0, live_values_count_);
   graph_.clear();
   operands_map_.clear();
   pending_loads_.clear();
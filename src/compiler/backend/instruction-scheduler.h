@@ -67,6 +67,31 @@ class InstructionScheduler final : public ZoneObject {
       unscheduled_predecessors_count_--;
     }
 
+    // Record that this instruction uses a value defined by 'producer' in the
+    // same block.
+    void AddOperandProducer(ScheduleGraphNode* producer) {
+      operand_producers_.push_back(producer);
+      producer->unscheduled_uses_count_++;
+    }
+
+    // Check if the value defined by this instruction is still needed by an
+    // unscheduled instruction of the block, i.e. whether it is live.
+    bool HasUnscheduledUse() const { return unscheduled_uses_count_ != 0; }
+
+    // Record that we have scheduled one of the uses of this node's value.
+    void DropUnscheduledUse() {
+      DCHECK_LT(0, unscheduled_uses_count_);
+      unscheduled_uses_count_--;
+    }
+
+    // Estimate by how many values the number of live values changes when
+    // this instruction is scheduled next.
+    int RegisterPressureDelta() const;
+
+    const ZoneVector<ScheduleGraphNode*>& operand_producers() const {
+      return operand_producers_;
+    }
+
     Instruction* instruction() { return instr_; }
     ZoneDeque<ScheduleGraphNode*>& successors() { return successors_; }
     int latency() const { return latency_; }
@@ -84,6 +109,11 @@ class InstructionScheduler final : public ZoneObject {
     // Number of unscheduled predecessors for this node.
     int unscheduled_predecessors_count_;
 
+    // Instructions of the same block defining the inputs of this node, and
+    // the number of unscheduled uses of the value defined by this node.
+    ZoneVector<ScheduleGraphNode*> operand_producers_;
+    int unscheduled_uses_count_;
+
     // Estimate of the instruction latency (the number of cycles it takes for
     // instruction to complete).
     int latency_;
@@ -119,7 +149,9 @@ class InstructionScheduler final : public ZoneObject {
 
   // A scheduling queue which prioritize nodes on the critical path (we look
   // for the instruction with the highest latency on the path to reach the end
-  // of the graph).
+  // of the graph). Once the number of live values reaches the number of
+  // allocatable registers, instructions which end live ranges are preferred
+  // over those that start new ones, to avoid introducing spills.
   class CriticalPathFirstQueue : public SchedulingQueueBase {
    public:
     explicit CriticalPathFirstQueue(InstructionScheduler* scheduler)
@@ -206,6 +238,10 @@ class InstructionScheduler final : public ZoneObject {
 
   void ComputeTotalLatencies();
 
+  bool IsUnderRegisterPressure() const {
+    return live_values_count_ >= register_pressure_limit_;
+  }
+
   static int GetInstructionLatency(const Instruction* instr);
 
   Zone* zone() { return zone_; }
@@ -243,6 +279,12 @@ class InstructionScheduler final : public ZoneObject {
   // record operand dependencies in the scheduling graph.
   ZoneMap<int32_t, ScheduleGraphNode*> operands_map_;
 
+  // Number of values defined in the current block that are still used by
+  // unscheduled instructions, and the number at which we start to schedule
+  // for register pressure rather than latency.
+  int live_values_count_;
+  const int register_pressure_limit_;
+
   base::Optional<base::RandomNumberGenerator> random_number_generator_;
 };
 
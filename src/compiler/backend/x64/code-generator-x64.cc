@@ -3921,6 +3921,18 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
     case kX64S16x8Dup: {
       XMMRegister dst = i.OutputSimd128Register();
       uint8_t lane = i.InputInt8(1) & 0x7;
+      if (CpuFeatures::IsSupported(AVX2)) {
+        CpuFeatureScope avx_scope(tasm(), AVX);
+        CpuFeatureScope avx2_scope(tasm(), AVX2);
+        // Shift the lane down to lane 0, then broadcast it.
+        XMMRegister src = i.InputSimd128Register(0);
+        if (lane != 0) {
+          __ vpsrldq(kScratchDoubleReg, src, lane * 2);
+          src = kScratchDoubleReg;
+        }
+        __ vpbroadcastw(dst, src);
+        break;
+      }
       uint8_t lane4 = lane & 0x3;
       uint8_t half_dup = lane4 | (lane4 << 2) | (lane4 << 4) | (lane4 << 6);
       if (lane < 4) {
@@ -3935,6 +3947,18 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
     case kX64S8x16Dup: {
       XMMRegister dst = i.OutputSimd128Register();
       uint8_t lane = i.InputInt8(1) & 0xf;
+      if (CpuFeatures::IsSupported(AVX2)) {
+        CpuFeatureScope avx_scope(tasm(), AVX);
+        CpuFeatureScope avx2_scope(tasm(), AVX2);
+        // Shift the lane down to lane 0, then broadcast it.
+        XMMRegister src = i.InputSimd128Register(0);
+        if (lane != 0) {
+          __ vpsrldq(kScratchDoubleReg, src, lane);
+          src = kScratchDoubleReg;
+        }
+        __ vpbroadcastb(dst, src);
+        break;
+      }
       DCHECK_EQ(dst, i.InputSimd128Register(0));
       if (lane < 8) {
         __ Punpcklbw(dst, dst);
@@ -445,66 +445,129 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+namespace {
+
+// Load-to-use latency of an L1 hit, including address generation.
+constexpr int kL1LoadLatency = 5;
+
+bool LoadsFromMemory(const Instruction* instr) {
+  switch (instr->arch_opcode()) {
+    case kX64Lea:
+    case kX64Lea32:
+      // Uses an addressing mode, but does not access memory.
+      return false;
+    case kX64Peek:
+      return true;
+    default:
+      return instr->HasOutput() && instr->addressing_mode() != kMode_None;
+  }
+}
+
+int GetArithmeticLatency(const Instruction* instr) {
   switch (instr->arch_opcode()) {
-    case kSSEFloat64Mul:
-      return 5;
     case kX64Imul:
     case kX64Imul32:
+    case kX64Popcnt:
+    case kX64Popcnt32:
+    case kX64Lzcnt:
+    case kX64Lzcnt32:
+    case kX64Tzcnt:
+    case kX64Tzcnt32:
+    case kSSEFloat32Cmp:
+    case kSSEFloat64Cmp:
+    case kAVXFloat32Cmp:
+    case kAVXFloat64Cmp:
+      return 3;
     case kX64ImulHigh32:
     case kX64UmulHigh32:
-    case kX64Float32Abs:
-    case kX64Float32Neg:
-    case kX64Float64Abs:
-    case kX64Float64Neg:
-    case kSSEFloat32Cmp:
     case kSSEFloat32Add:
     case kSSEFloat32Sub:
-    case kSSEFloat64Cmp:
+    case kSSEFloat32Mul:
     case kSSEFloat64Add:
     case kSSEFloat64Sub:
+    case kSSEFloat64Mul:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat32Mul:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+    case kAVXFloat64Mul:
+    case kSSEFloat32Max:
+    case kSSEFloat32Min:
     case kSSEFloat64Max:
     case kSSEFloat64Min:
-      return 3;
-    case kSSEFloat32Mul:
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
-    case kSSEFloat32Round:
-    case kSSEFloat64Round:
+    case kX64F32x4Add:
+    case kX64F32x4Sub:
+    case kX64F32x4Mul:
+    case kX64F64x2Add:
+    case kX64F64x2Sub:
+    case kX64F64x2Mul:
+    case kX64F32x4Qfma:
+    case kX64F32x4Qfms:
+    case kX64F64x2Qfma:
+    case kX64F64x2Qfms:
+      return 4;
+    case kSSEInt32ToFloat32:
+    case kSSEInt32ToFloat64:
+    case kSSEInt64ToFloat32:
+    case kSSEInt64ToFloat64:
+    case kX64I16x8Mul:
+      return 5;
     case kSSEFloat32ToInt32:
     case kSSEFloat32ToUint32:
     case kSSEFloat64ToInt32:
     case kSSEFloat64ToUint32:
-      return 4;
-    case kX64Idiv:
-      return 49;
-    case kX64Idiv32:
-      return 35;
-    case kX64Udiv:
-      return 38;
-    case kX64Udiv32:
-      return 26;
-    case kSSEFloat32Div:
-    case kSSEFloat64Div:
-    case kSSEFloat32Sqrt:
-    case kSSEFloat64Sqrt:
-      return 13;
+    case kArchTruncateDoubleToI:
+      return 6;
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+      return 8;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
     case kSSEFloat64ToUint64:
+    case kX64I32x4Mul:
       return 10;
+    case kSSEFloat32Div:
+    case kAVXFloat32Div:
+    case kX64F32x4Div:
+      return 11;
+    case kX64Idiv32:
+    case kX64Udiv32:
+    case kSSEFloat32Sqrt:
+    case kX64F32x4Sqrt:
+      return 12;
+    case kSSEFloat64Div:
+    case kAVXFloat64Div:
+    case kX64F64x2Div:
+      return 14;
+    case kSSEFloat64Sqrt:
+    case kX64F64x2Sqrt:
+      return 16;
+    case kX64Idiv:
+    case kX64Udiv:
+      return 18;
     case kSSEFloat64Mod:
       return 50;
-    case kArchTruncateDoubleToI:
-      return 6;
     default:
       return 1;
   }
 }
 
+}  // namespace
+
+int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+  // Latencies model recent out-of-order cores (Ice Lake and Zen 3 class),
+  // taking the slower of the two where they differ. Values are based on
+  // published per-instruction measurements; division and square root are
+  // data dependent and use typical rather than worst case values.
+  int latency = GetArithmeticLatency(instr);
+  if (LoadsFromMemory(instr)) latency += kL1LoadLatency - 1;
+  return latency;
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
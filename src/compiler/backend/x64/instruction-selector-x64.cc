@@ -3642,7 +3642,9 @@ void InstructionSelector::VisitI8x16Shuffle(Node* node) {
     }
   } else if (wasm::SimdShuffle::TryMatchSplat<16>(shuffle, &index)) {
     opcode = kX64S8x16Dup;
-    no_same_as_first = false;
+    // With AVX2, the lane is broadcast with vpbroadcastb, which does not need
+    // same-as-first.
+    no_same_as_first = CpuFeatures::IsSupported(AVX2);
     src0_needs_reg = true;
     imms[imm_count++] = index;
   }
@@ -305,6 +305,7 @@ class EffectControlLinearizer {
 
   // Pass {bitfield} = {digit} = nullptr to construct the canoncial 0n BigInt.
   Node* BuildAllocateBigInt(Node* bitfield, Node* digit);
+  Node* BuildAllocateConsString(Node* length, Node* first, Node* second);
 
   void TransitionElementsTo(Node* node, Node* array, ElementsKind from,
                             ElementsKind to);
@@ -2135,20 +2136,45 @@ void EffectControlLinearizer::LowerCheckIf(Node* node, Node* frame_state) {
 }
 
 Node* EffectControlLinearizer::LowerStringConcat(Node* node) {
+  Node* length = node->InputAt(0);
   Node* lhs = node->InputAt(1);
   Node* rhs = node->InputAt(2);
 
-  Callable const callable =
-      CodeFactory::StringAdd(isolate(), STRING_ADD_CHECK_NONE);
-  auto call_descriptor = Linkage::GetStubCallDescriptor(
-      graph()->zone(), callable.descriptor(),
-      callable.descriptor().GetStackParameterCount(), CallDescriptor::kNoFlags,
-      Operator::kNoDeopt | Operator::kNoWrite | Operator::kNoThrow);
+  auto if_cons = __ MakeLabel();
+  auto if_call = __ MakeLabel();
+  auto done = __ MakeLabel(MachineRepresentation::kTaggedPointer);
 
-  Node* value = __ Call(call_descriptor, __ HeapConstant(callable.code()), lhs,
-                        rhs, __ NoContextConstant());
+  // Repeated concatenation like `s += part` mostly produces results that are
+  // long enough for a ConsString, so build those inline and leave empty
+  // inputs and short flat results to the StringAdd builtin. The {length} has
+  // already been checked against String::kMaxLength.
+  Node* min_length = __ Uint32Constant(ConsString::kMinLength);
+  __ GotoIf(__ Uint32LessThan(length, min_length), &if_call);
+  Node* lhs_length = __ LoadField(AccessBuilder::ForStringLength(), lhs);
+  __ GotoIf(__ Word32Equal(lhs_length, __ Int32Constant(0)), &if_call);
+  Node* rhs_length = __ LoadField(AccessBuilder::ForStringLength(), rhs);
+  __ Branch(__ Word32Equal(rhs_length, __ Int32Constant(0)), &if_call,
+            &if_cons);
+
+  __ Bind(&if_cons);
+  __ Goto(&done, BuildAllocateConsString(length, lhs, rhs));
+
+  __ Bind(&if_call);
+  {
+    Callable const callable =
+        CodeFactory::StringAdd(isolate(), STRING_ADD_CHECK_NONE);
+    auto call_descriptor = Linkage::GetStubCallDescriptor(
+        graph()->zone(), callable.descriptor(),
+        callable.descriptor().GetStackParameterCount(),
+        CallDescriptor::kNoFlags,
+        Operator::kNoDeopt | Operator::kNoWrite | Operator::kNoThrow);
+    Node* value = __ Call(call_descriptor, __ HeapConstant(callable.code()),
+                          lhs, rhs, __ NoContextConstant());
+    __ Goto(&done, value);
+  }
 
-  return value;
+  __ Bind(&done);
+  return done.PhiAt(0);
 }
 
 Node* EffectControlLinearizer::LowerCheckedInt32Add(Node* node,
@@ -3851,7 +3877,12 @@ Node* EffectControlLinearizer::LowerNewConsString(Node* node) {
   Node* length = node->InputAt(0);
   Node* first = node->InputAt(1);
   Node* second = node->InputAt(2);
+  return BuildAllocateConsString(length, first, second);
+}
 
+Node* EffectControlLinearizer::BuildAllocateConsString(Node* length,
+                                                       Node* first,
+                                                       Node* second) {
   // Determine the instance types of {first} and {second}.
   Node* first_map = __ LoadField(AccessBuilder::ForMap(), first);
   Node* first_instance_type =
@@ -4990,6 +5021,8 @@ MachineType MachineTypeFor(CTypeInfo::Type type) {
       return MachineType::AnyTagged();
     case CTypeInfo::Type::kBool:
       return MachineType::Bool();
+    case CTypeInfo::Type::kUint8:
+      return MachineType::Uint8();
     case CTypeInfo::Type::kInt32:
       return MachineType::Int32();
     case CTypeInfo::Type::kUint32:
@@ -5006,6 +5039,8 @@ MachineType MachineTypeFor(CTypeInfo::Type type) {
       return MachineType::Float32();
     case CTypeInfo::Type::kFloat64:
       return MachineType::Float64();
+    case CTypeInfo::Type::kSeqOneByteString:
+      return MachineType::Pointer();
     case CTypeInfo::Type::kV8Value:
     case CTypeInfo::Type::kApiObject:
       return MachineType::AnyTagged();
@@ -5115,6 +5150,49 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
 
           return stack_slot;
         }
+        case CTypeInfo::Type::kSeqOneByteString: {
+          // Check that the value is a flat sequential one-byte string.
+          Node* value_is_smi = ObjectIsSmi(node);
+          __ GotoIf(value_is_smi, if_error);
+
+          Node* value_map = __ LoadField(AccessBuilder::ForMap(), node);
+          Node* value_instance_type =
+              __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+          Node* masked_instance_type = __ Word32And(
+              value_instance_type,
+              __ Int32Constant(kIsNotStringMask |
+                               kStringRepresentationAndEncodingMask));
+          Node* value_is_seq_one_byte_string = __ Word32Equal(
+              masked_instance_type,
+              __ Int32Constant(kStringTag | kSeqOneByteStringTag));
+          __ GotoIfNot(value_is_seq_one_byte_string, if_error);
+
+          // Unpack the characters and length, and store them to a struct
+          // FastOneByteString. The characters are not copied, so the
+          // pointer is only valid until the next GC, which cannot happen
+          // during the fast call.
+          Node* length = __ LoadField(AccessBuilder::ForStringLength(), node);
+          Node* data_ptr = __ IntPtrAdd(
+              __ BitcastTaggedToWord(node),
+              __ IntPtrConstant(SeqOneByteString::kHeaderSize -
+                                kHeapObjectTag));
+
+          constexpr int kStringAlign = alignof(FastOneByteString);
+          constexpr int kStringSize = sizeof(FastOneByteString);
+          Node* stack_slot = __ StackSlot(kStringSize, kStringAlign);
+          __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                                       kNoWriteBarrier),
+                   stack_slot,
+                   static_cast<int>(offsetof(FastOneByteString, data)),
+                   data_ptr);
+          __ Store(StoreRepresentation(MachineRepresentation::kWord32,
+                                       kNoWriteBarrier),
+                   stack_slot,
+                   static_cast<int>(offsetof(FastOneByteString, length)),
+                   length);
+
+          return stack_slot;
+        }
         case CTypeInfo::Type::kFloat32: {
           return __ TruncateFloat64ToFloat32(node);
         }
@@ -5466,9 +5544,18 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
     case CTypeInfo::Type::kUint32:
       fast_call_result = ChangeUint32ToTagged(c_call_result);
       break;
+    case CTypeInfo::Type::kUint8:
+      UNREACHABLE();
     case CTypeInfo::Type::kInt64:
+      fast_call_result =
+          ChangeFloat64ToTagged(__ ChangeInt64ToFloat64(c_call_result),
+                                CheckForMinusZeroMode::kCheckForMinusZero);
+      break;
     case CTypeInfo::Type::kUint64:
-      UNREACHABLE();
+      fast_call_result =
+          ChangeFloat64ToTagged(__ RoundUint64ToFloat64(c_call_result),
+                                CheckForMinusZeroMode::kCheckForMinusZero);
+      break;
     case CTypeInfo::Type::kFloat32:
       fast_call_result =
           ChangeFloat64ToTagged(__ ChangeFloat32ToFloat64(c_call_result),
@@ -5479,6 +5566,7 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
           c_call_result, CheckForMinusZeroMode::kCheckForMinusZero);
       break;
     case CTypeInfo::Type::kV8Value:
+    case CTypeInfo::Type::kSeqOneByteString:
     case CTypeInfo::Type::kApiObject:
       UNREACHABLE();
     case CTypeInfo::Type::kAny:
@@ -204,6 +204,23 @@ class EscapeAnalysisTracker : public ZoneObject {
       vobject_ = tracker_->virtual_objects_.Get(object);
     }
 
+    // Whether value input {i} of the current node has been reduced. An input
+    // that is not reduced yet has no replacement either.
+    bool IsValueInputReduced(int i) {
+      return reducer_->IsReduced(
+          NodeProperties::GetValueInput(current_node(), i));
+    }
+
+    // Whether {node} is the current node, possibly wrapped in nodes that
+    // escape analysis treats as aliases of their input.
+    bool IsAliasOfCurrentNode(Node* node) {
+      while (node->opcode() == IrOpcode::kTypeGuard ||
+             node->opcode() == IrOpcode::kFinishRegion) {
+        node = NodeProperties::GetValueInput(node, 0);
+      }
+      return node == current_node();
+    }
+
     void SetEscaped(Node* node) {
       if (VirtualObject* object = tracker_->virtual_objects_.Get(node)) {
         if (object->HasEscaped()) return;
@@ -286,6 +303,7 @@ EffectGraphReducer::EffectGraphReducer(
     TickCounter* tick_counter, Zone* zone)
     : graph_(graph),
       state_(graph, kNumStates),
+      reduced_(graph, 2),
       revisit_(zone),
       stack_(zone),
       reduce_(std::move(reduce)),
@@ -323,13 +341,18 @@ void EffectGraphReducer::ReduceFrom(Node* node) {
       stack_.pop();
       Reduction reduction;
       reduce_(current, &reduction);
+      // Uses that were reduced before {current} itself, i.e. along a cycle,
+      // have seen it unreduced and need to be revisited even if its reduction
+      // did not change anything.
+      bool first_reduction = !reduced_.Get(current);
+      reduced_.Set(current, true);
       for (Edge edge : current->use_edges()) {
         // Mark uses for revisitation.
         Node* use = edge.from();
         if (NodeProperties::IsEffectEdge(edge)) {
           if (reduction.effect_changed()) Revisit(use);
         } else {
-          if (reduction.value_changed()) Revisit(use);
+          if (reduction.value_changed() || first_reduction) Revisit(use);
         }
       }
       state_.Set(current, State::kVisited);
@@ -698,6 +721,41 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       current->SetVirtualObject(current->ValueInput(0));
       break;
     }
+    case IrOpcode::kPhi: {
+      // A phi that only merges a virtual object with itself is an alias of
+      // that object. This is typically a loop phi for an object allocated
+      // before the loop, whose back edge carries the phi around unchanged.
+      // Deoptimizations inside of the loop materialize the object from its
+      // FrameState uses like for any other virtual object. Inputs that are
+      // not reduced yet, like the back edge of a loop phi that is visited
+      // before the loop body, are skipped for now; the phi is revisited once
+      // they are reduced, so their objects only escape if they really differ.
+      Node* object = nullptr;
+      const VirtualObject* vobject = nullptr;
+      bool is_alias = true;
+      int value_input_count = op->ValueInputCount();
+      for (int i = 0; i < value_input_count; ++i) {
+        if (!current->IsValueInputReduced(i)) continue;
+        Node* input = current->ValueInput(i);
+        if (current->IsAliasOfCurrentNode(input)) continue;
+        const VirtualObject* input_vobject = current->GetVirtualObject(input);
+        if (input_vobject == nullptr || input_vobject->HasEscaped() ||
+            (vobject != nullptr && input_vobject != vobject)) {
+          is_alias = false;
+          break;
+        }
+        object = input;
+        vobject = input_vobject;
+      }
+      if (is_alias && object != nullptr) {
+        current->SetVirtualObject(object);
+        break;
+      }
+      for (int i = 0; i < value_input_count; ++i) {
+        current->SetEscaped(current->ValueInput(i));
+      }
+      break;
+    }
     case IrOpcode::kReferenceEqual: {
       Node* left = current->ValueInput(0);
       Node* right = current->ValueInput(1);
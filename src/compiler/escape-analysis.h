@@ -60,6 +60,9 @@ class EffectGraphReducer {
 
   bool Complete() { return stack_.empty() && revisit_.empty(); }
 
+  // Whether {node} has been reduced at least once.
+  bool IsReduced(Node* node) { return reduced_.Get(node); }
+
   TickCounter* tick_counter() const { return tick_counter_; }
 
  private:
@@ -72,6 +75,7 @@ class EffectGraphReducer {
   const uint8_t kNumStates = static_cast<uint8_t>(State::kVisited) + 1;
   Graph* graph_;
   NodeMarker<State> state_;
+  NodeMarker<bool> reduced_;
   ZoneStack<Node*> revisit_;
   ZoneStack<NodeState> stack_;
   std::function<void(Node*, Reduction*)> reduce_;
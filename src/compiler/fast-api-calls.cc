@@ -11,6 +11,8 @@ namespace fast_api_call {
 
 ElementsKind GetTypedArrayElementsKind(CTypeInfo::Type type) {
   switch (type) {
+    case CTypeInfo::Type::kUint8:
+      return UINT8_ELEMENTS;
     case CTypeInfo::Type::kInt32:
       return INT32_ELEMENTS;
     case CTypeInfo::Type::kUint32:
@@ -26,6 +28,7 @@ ElementsKind GetTypedArrayElementsKind(CTypeInfo::Type type) {
     case CTypeInfo::Type::kVoid:
     case CTypeInfo::Type::kBool:
     case CTypeInfo::Type::kV8Value:
+    case CTypeInfo::Type::kSeqOneByteString:
     case CTypeInfo::Type::kApiObject:
     case CTypeInfo::Type::kAny:
       UNREACHABLE();
@@ -50,6 +50,7 @@ class Reducer;
   V(Float64SilenceNaN)                   \
   V(RoundFloat64ToInt32)                 \
   V(RoundInt32ToFloat32)                 \
+  V(RoundUint64ToFloat64)                \
   V(TruncateFloat64ToFloat32)            \
   V(TruncateFloat64ToWord32)             \
   V(TruncateInt64ToInt32)                \
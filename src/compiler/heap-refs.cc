@@ -2648,6 +2648,10 @@ SharedFunctionInfoRef FeedbackVectorRef::shared_function_info() const {
   return MakeRefAssumeMemoryFence(broker(), object()->shared_function_info());
 }
 
+int FeedbackVectorRef::invocation_count() const {
+  return object()->invocation_count(kRelaxedLoad);
+}
+
 bool NameRef::IsUniqueName() const {
   // Must match Name::IsUniqueName.
   return IsInternalizedString() || IsSymbol();
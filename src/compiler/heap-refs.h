@@ -633,6 +633,10 @@ class FeedbackVectorRef : public HeapObjectRef {
   SharedFunctionInfoRef shared_function_info() const;
 
   FeedbackCellRef GetClosureFeedbackCell(int index) const;
+
+  // The number of invocations of the function so far. This is a racy read
+  // and may only be used for heuristics.
+  int invocation_count() const;
 };
 
 class CallHandlerInfoRef : public HeapObjectRef {
@@ -19,6 +19,7 @@
 #include "src/compiler/simplified-operator.h"
 #include "src/compiler/state-values-utils.h"
 #include "src/execution/protectors.h"
+#include "src/objects/allocation-site-inl.h"
 #include "src/objects/arguments.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/heap-number.h"
@@ -52,6 +53,31 @@ const int kElementLoopUnrollLimit = 16;
 const int kFunctionContextAllocationLimit = 16;
 const int kBlockContextAllocationLimit = 16;
 
+// Whether the object produced by {node} already escapes, i.e. it has uses other
+// than deoptimization state and loads from the object itself. Conservatively
+// answers true for all other uses, including phis.
+bool HasEscapingUse(Node* node) {
+  for (Edge edge : node->use_edges()) {
+    if (!NodeProperties::IsValueEdge(edge)) continue;
+    switch (edge.from()->opcode()) {
+      case IrOpcode::kFrameState:
+      case IrOpcode::kStateValues:
+      case IrOpcode::kTypedStateValues:
+      case IrOpcode::kObjectState:
+      case IrOpcode::kTypedObjectState:
+        continue;
+      case IrOpcode::kJSLoadNamed:
+      case IrOpcode::kJSLoadProperty:
+        if (edge.index() == 0) continue;
+        break;
+      default:
+        break;
+    }
+    return true;
+  }
+  return false;
+}
+
 }  // namespace
 
 Reduction JSCreateLowering::Reduce(Node* node) {
@@ -689,6 +715,23 @@ Reduction JSCreateLowering::ReduceJSCreateArray(Node* node) {
       return ReduceNewArray(node, length, capacity, *initial_map, elements_kind,
                             allocation, slack_tracking_prediction);
     }
+    if (length_type.Is(Type::SignedSmall()) && length_type.Min() >= 0 &&
+        length_type.Max() <= kElementLoopUnrollLimit && can_inline_call) {
+      // The length is not a constant, but small and bounded. Allocate the
+      // backing store with the maximum capacity, so that the allocation has
+      // a constant size and escape analysis can scalar replace the array.
+      int capacity = static_cast<int>(length_type.Max());
+      // Check the length against the capacity in order to protect against a
+      // potential typer bug leading to length > capacity.
+      Node* effect = NodeProperties::GetEffectInput(node);
+      Node* control = NodeProperties::GetControlInput(node);
+      length = effect = graph()->NewNode(
+          simplified()->CheckBounds(FeedbackSource()), length,
+          jsgraph()->Constant(capacity + 1), effect, control);
+      NodeProperties::ReplaceEffectInput(node, effect);
+      return ReduceNewArray(node, length, capacity, *initial_map, elements_kind,
+                            allocation, slack_tracking_prediction);
+    }
     if (length_type.Maybe(Type::UnsignedSmall()) && can_inline_call) {
       return ReduceNewArray(node, length, *initial_map, elements_kind,
                             allocation, slack_tracking_prediction);
@@ -1105,14 +1148,39 @@ Reduction JSCreateLowering::ReduceJSCreateLiteralArrayOrObject(Node* node) {
   if (!feedback.IsInsufficient()) {
     AllocationSiteRef site = feedback.AsLiteral().value();
     if (!site.boilerplate().has_value()) return NoChange();
-    AllocationType allocation = dependencies()->DependOnPretenureMode(site);
+    // Literals of inlined callees may have a site of their own that decides
+    // pretenuring in this caller only. As long as that site still allocates
+    // young, attach mementos to its objects so that it learns whether they
+    // survive here. Objects that don't escape yet are left to escape analysis
+    // instead; they don't live long enough to need pretenuring. Mementos are
+    // not supported with map packing, as the memento map is stored at an
+    // offset other than the object's map offset.
+    base::Optional<AllocationSiteRef> context_site;
+    if (FLAG_turbo_context_pretenuring) {
+      context_site = broker()->GetContextAllocationSite(site);
+    }
+    AllocationType allocation = dependencies()->DependOnPretenureMode(
+        context_site.has_value() ? *context_site : site);
+    base::Optional<AllocationSiteRef> memento_site;
+    if (!V8_MAP_PACKING_BOOL && context_site.has_value() &&
+        allocation == AllocationType::kYoung &&
+        AllocationSite::CanTrack(site.boilerplate()->map().instance_type()) &&
+        HasEscapingUse(node)) {
+      memento_site = context_site;
+    }
     int max_properties = kMaxFastLiteralProperties;
-    base::Optional<Node*> maybe_value =
-        TryAllocateFastLiteral(effect, control, *site.boilerplate(), allocation,
-                               kMaxFastLiteralDepth, &max_properties);
+    base::Optional<Node*> maybe_value = TryAllocateFastLiteral(
+        effect, control, *site.boilerplate(), allocation, kMaxFastLiteralDepth,
+        &max_properties, memento_site);
     if (!maybe_value.has_value()) return NoChange();
     dependencies()->DependOnElementsKinds(site);
     Node* value = effect = maybe_value.value();
+    if (memento_site.has_value()) {
+      // The object already escapes, but it might still only be stored into
+      // objects that escape analysis replaces later. Keep it in that case, as
+      // the deoptimizer cannot materialize an object with a trailing memento.
+      effect = graph()->NewNode(common()->Retain(), value, effect);
+    }
     ReplaceWithValue(node, value, effect, control);
     return Replace(value);
   }
@@ -1665,7 +1733,8 @@ Node* JSCreateLowering::AllocateElements(Node* effect, Node* control,
 
 base::Optional<Node*> JSCreateLowering::TryAllocateFastLiteral(
     Node* effect, Node* control, JSObjectRef boilerplate,
-    AllocationType allocation, int max_depth, int* max_properties) {
+    AllocationType allocation, int max_depth, int* max_properties,
+    base::Optional<AllocationSiteRef> memento_site) {
   DCHECK_GE(max_depth, 0);
   DCHECK_GE(*max_properties, 0);
 
@@ -1811,10 +1880,25 @@ base::Optional<Node*> JSCreateLowering::TryAllocateFastLiteral(
   Node* elements = maybe_elements.value();
   if (elements->op()->EffectOutputCount() > 0) effect = elements;
 
+  // Count the memento as created before the allocation, like CSA does.
+  if (memento_site.has_value()) {
+    FieldAccess const access =
+        AccessBuilder::ForAllocationSitePretenureCreateCount();
+    Node* site = jsgraph()->Constant(*memento_site);
+    Node* count = effect = graph()->NewNode(simplified()->LoadField(access),
+                                            site, effect, control);
+    count = graph()->NewNode(simplified()->NumberAdd(), count,
+                             jsgraph()->OneConstant());
+    effect = graph()->NewNode(simplified()->StoreField(access), site, count,
+                              effect, control);
+  }
+
   // Actually allocate and initialize the object.
+  int const instance_size = boilerplate_map.instance_size();
   AllocationBuilder builder(jsgraph(), effect, control);
-  builder.Allocate(boilerplate_map.instance_size(), allocation,
-                   Type::For(boilerplate_map));
+  builder.Allocate(
+      instance_size + (memento_site.has_value() ? AllocationMemento::kSize : 0),
+      allocation, Type::For(boilerplate_map));
   builder.Store(AccessBuilder::ForMap(), boilerplate_map);
   builder.Store(AccessBuilder::ForJSObjectPropertiesOrHashKnownPointer(),
                 jsgraph()->EmptyFixedArrayConstant());
@@ -1828,6 +1912,30 @@ base::Optional<Node*> JSCreateLowering::TryAllocateFastLiteral(
   for (auto const& inobject_field : inobject_fields) {
     builder.Store(inobject_field.first, inobject_field.second);
   }
+  if (!memento_site.has_value()) return builder.Finish();
+
+  // The AllocationMemento directly follows the object. With map packing, the
+  // map would have to be packed, which only happens for stores to the object's
+  // own map offset.
+  DCHECK(!V8_MAP_PACKING_BOOL);
+  FieldAccess memento_map = {kTaggedBase,
+                             instance_size,
+                             MaybeHandle<Name>(),
+                             MaybeHandle<Map>(),
+                             Type::OtherInternal(),
+                             MachineType::TaggedPointer(),
+                             kNoWriteBarrier};
+  builder.Store(memento_map,
+                MakeRef(broker(), factory()->allocation_memento_map()));
+  FieldAccess memento_site_field = {
+      kTaggedBase,
+      instance_size + AllocationMemento::kAllocationSiteOffset,
+      MaybeHandle<Name>(),
+      MaybeHandle<Map>(),
+      Type::OtherInternal(),
+      MachineType::TaggedPointer(),
+      kNoWriteBarrier};
+  builder.Store(memento_site_field, *memento_site);
   return builder.Finish();
 }
 
@@ -97,11 +97,10 @@ class V8_EXPORT_PRIVATE JSCreateLowering final
                                     Node* arguments_length,
                                     const SharedFunctionInfoRef& shared,
                                     bool* has_aliased_arguments);
-  base::Optional<Node*> TryAllocateFastLiteral(Node* effect, Node* control,
-                                               JSObjectRef boilerplate,
-                                               AllocationType allocation,
-                                               int max_depth,
-                                               int* max_properties);
+  base::Optional<Node*> TryAllocateFastLiteral(
+      Node* effect, Node* control, JSObjectRef boilerplate,
+      AllocationType allocation, int max_depth, int* max_properties,
+      base::Optional<AllocationSiteRef> memento_site = {});
   base::Optional<Node*> TryAllocateFastLiteralElements(
       Node* effect, Node* control, JSObjectRef boilerplate,
       AllocationType allocation, int max_depth, int* max_properties);
@@ -17,7 +17,9 @@
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/data-handler-inl.h"
 #include "src/objects/feedback-cell.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/js-array-inl.h"
+#include "src/objects/js-function-inl.h"
 #include "src/objects/literal-objects-inl.h"
 #include "src/objects/map-updater.h"
 #include "src/objects/objects-inl.h"
@@ -54,6 +56,7 @@ JSHeapBroker::JSHeapBroker(Isolate* isolate, Zone* broker_zone,
                                  zone())),
       root_index_map_(isolate),
       array_and_object_prototypes_(zone()),
+      context_allocation_sites_(zone()),
       tracing_enabled_(tracing_enabled),
       is_concurrent_inlining_(is_concurrent_inlining),
       code_kind_(code_kind),
@@ -186,6 +189,64 @@ bool JSHeapBroker::IsArrayOrObjectPrototype(Handle<JSObject> object) const {
          array_and_object_prototypes_.end();
 }
 
+void JSHeapBroker::CollectContextAllocationSites(Handle<JSFunction> closure) {
+  DCHECK(FLAG_turbo_context_pretenuring);
+  if (!closure->has_feedback_vector()) return;
+
+  // Collect the literal sites of the direct monomorphic callees first, since
+  // creating the context sites may allocate.
+  std::vector<Handle<AllocationSite>> sites;
+  FeedbackVector vector = closure->feedback_vector();
+  FeedbackMetadataIterator iter(vector.metadata());
+  while (iter.HasNext()) {
+    FeedbackSlot slot = iter.Next();
+    if (iter.kind() != FeedbackSlotKind::kCall) continue;
+    HeapObject target;
+    if (!vector.Get(slot)->GetHeapObjectIfWeak(&target) ||
+        !target.IsJSFunction() || target == *closure ||
+        !JSFunction::cast(target).has_feedback_vector()) {
+      continue;
+    }
+    FeedbackVector callee_vector = JSFunction::cast(target).feedback_vector();
+    FeedbackMetadataIterator callee_iter(callee_vector.metadata());
+    while (callee_iter.HasNext()) {
+      FeedbackSlot callee_slot = callee_iter.Next();
+      if (callee_iter.kind() != FeedbackSlotKind::kLiteral) continue;
+      HeapObject object;
+      if (!callee_vector.Get(callee_slot)->GetHeapObjectIfStrong(&object) ||
+          !object.IsAllocationSite()) {
+        continue;
+      }
+      AllocationSite site = AllocationSite::cast(object);
+      if (!site.PointsToLiteral() ||
+          site.GetAllocationType() == AllocationType::kOld) {
+        continue;
+      }
+      sites.push_back(handle(site, isolate()));
+    }
+  }
+
+  Handle<SharedFunctionInfo> caller(closure->shared(), isolate());
+  for (Handle<AllocationSite> site : sites) {
+    Handle<AllocationSite> context_site;
+    if (!isolate()
+             ->heap()
+             ->GetOrCreateContextAllocationSite(caller, site)
+             .ToHandle(&context_site)) {
+      break;
+    }
+    context_allocation_sites_.emplace(CanonicalPersistentHandle(site),
+                                      CanonicalPersistentHandle(context_site));
+  }
+}
+
+base::Optional<AllocationSiteRef> JSHeapBroker::GetContextAllocationSite(
+    const AllocationSiteRef& site) {
+  auto it = context_allocation_sites_.find(site.object());
+  if (it == context_allocation_sites_.end()) return {};
+  return MakeRef(this, it->second);
+}
+
 ObjectData* JSHeapBroker::TryGetOrCreateData(Object object,
                                              GetOrCreateDataFlags flags) {
   return TryGetOrCreateData(CanonicalPersistentHandle(object), flags);
@@ -178,6 +178,15 @@ class V8_EXPORT_PRIVATE JSHeapBroker {
   bool IsArrayOrObjectPrototype(const JSObjectRef& object) const;
   bool IsArrayOrObjectPrototype(Handle<JSObject> object) const;
 
+  // Creates (on the main thread) the allocation sites that collect pretenuring
+  // feedback for literals of the monomorphic callees of {closure} when they
+  // are inlined into it. See Heap::GetOrCreateContextAllocationSite.
+  void CollectContextAllocationSites(Handle<JSFunction> closure);
+  // Returns the site that decides the pretenuring of the literal of {site} in
+  // the current compilation, if there is one.
+  base::Optional<AllocationSiteRef> GetContextAllocationSite(
+      const AllocationSiteRef& site);
+
   bool HasFeedback(FeedbackSource const& source) const;
   void SetFeedback(FeedbackSource const& source,
                    ProcessedFeedback const* feedback);
@@ -434,6 +443,10 @@ class V8_EXPORT_PRIVATE JSHeapBroker {
   ZoneUnorderedSet<Handle<JSObject>, Handle<JSObject>::hash,
                    Handle<JSObject>::equal_to>
       array_and_object_prototypes_;
+  ZoneUnorderedMap<Handle<AllocationSite>, Handle<AllocationSite>,
+                   Handle<AllocationSite>::hash,
+                   Handle<AllocationSite>::equal_to>
+      context_allocation_sites_;
   BrokerMode mode_ = kDisabled;
   bool const tracing_enabled_;
   bool const is_concurrent_inlining_;
@@ -4,6 +4,8 @@
 
 #include "src/compiler/js-inlining-heuristic.h"
 
+#include <algorithm>
+
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
@@ -11,6 +13,7 @@
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/simplified-operator.h"
 #include "src/objects/objects-inl.h"
+#include "src/zone/zone-containers.h"
 
 namespace v8 {
 namespace internal {
@@ -106,13 +109,13 @@ JSInliningHeuristic::Candidate JSInliningHeuristic::CollectFunctions(
   if (m.IsPhi()) {
     int const value_input_count = m.node()->op()->ValueInputCount();
     if (value_input_count > functions_size) {
-      out.num_functions = 0;
+      CollectDominantFunctions(callee, functions_size, &out);
       return out;
     }
     for (int n = 0; n < value_input_count; ++n) {
       HeapObjectMatcher m2(callee->InputAt(n));
       if (!m2.HasResolvedValue() || !m2.Ref(broker()).IsJSFunction()) {
-        out.num_functions = 0;
+        CollectDominantFunctions(callee, functions_size, &out);
         return out;
       }
 
@@ -151,6 +154,67 @@ JSInliningHeuristic::Candidate JSInliningHeuristic::CollectFunctions(
   return out;
 }
 
+void JSInliningHeuristic::CollectDominantFunctions(Node* callee,
+                                                   int functions_size,
+                                                   Candidate* out) {
+  DCHECK_EQ(IrOpcode::kPhi, callee->opcode());
+  out->num_functions = 0;
+  if (!FLAG_inline_dominant_targets) return;
+
+  // The {callee} phi either has too many inputs or some of its inputs are not
+  // known functions. Dispatch to the most frequently invoked of the known
+  // functions and leave all other targets to a generic call. The invocation
+  // counts are per function, not per call site, as the CallIC doesn't record
+  // targets beyond the monomorphic case. Megamorphic call sites without a phi
+  // of known targets are not handled.
+  struct Target {
+    JSFunctionRef function;
+    int invocation_count;
+  };
+  ZoneVector<Target> targets(graph()->zone());
+  int const value_input_count = callee->op()->ValueInputCount();
+  for (int n = 0; n < value_input_count; ++n) {
+    HeapObjectMatcher m(callee->InputAt(n));
+    if (!m.HasResolvedValue() || !m.Ref(broker()).IsJSFunction()) continue;
+    JSFunctionRef function = m.Ref(broker()).AsJSFunction();
+    if (std::any_of(targets.begin(), targets.end(), [&](const Target& t) {
+          return t.function.equals(function);
+        })) {
+      continue;
+    }
+    base::Optional<FeedbackVectorRef> feedback_vector =
+        function.raw_feedback_cell(dependencies()).feedback_vector();
+    // Functions that never ran are not worth a dispatch arm.
+    if (!feedback_vector.has_value()) continue;
+    int const invocation_count = feedback_vector->invocation_count();
+    if (invocation_count == 0) continue;
+    targets.push_back({function, invocation_count});
+  }
+  if (targets.empty()) return;
+
+  std::stable_sort(targets.begin(), targets.end(),
+                   [](const Target& a, const Target& b) {
+                     return a.invocation_count > b.invocation_count;
+                   });
+  // A partial scan of the phi inputs may have filled some of the slots
+  // already, and the dominant targets need not line up with them.
+  for (int i = 0; i < functions_size; ++i) {
+    out->functions[i].reset();
+    out->bytecode[i].reset();
+  }
+  int const num_functions =
+      std::min(static_cast<int>(targets.size()), functions_size);
+  for (int i = 0; i < num_functions; ++i) {
+    JSFunctionRef function = targets[i].function;
+    out->functions[i] = function;
+    if (CanConsiderForInlining(broker(), function)) {
+      out->bytecode[i] = function.shared().GetBytecodeArray();
+    }
+  }
+  out->num_functions = num_functions;
+  out->has_generic_fallback = true;
+}
+
 Reduction JSInliningHeuristic::Reduce(Node* node) {
 #if V8_ENABLE_WEBASSEMBLY
   if (mode() == kWasmOnly) {
@@ -175,7 +239,8 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   Candidate candidate = CollectFunctions(node, kMaxCallPolymorphism);
   if (candidate.num_functions == 0) {
     return NoChange();
-  } else if (candidate.num_functions > 1 && !FLAG_polymorphic_inlining) {
+  } else if ((candidate.num_functions > 1 || candidate.has_generic_fallback) &&
+             !FLAG_polymorphic_inlining) {
     TRACE("Not considering call site #"
           << node->id() << ":" << node->op()->mnemonic()
           << ", because polymorphic inlining is disabled");
@@ -645,7 +710,8 @@ void JSInliningHeuristic::CreateOrReuseDispatch(Node* node, Node* callee,
                                                 int input_count) {
   SourcePositionTable::Scope position(
       source_positions_, source_positions_->GetSourcePosition(node));
-  if (TryReuseDispatch(node, callee, if_successes, calls, inputs,
+  if (!candidate.has_generic_fallback &&
+      TryReuseDispatch(node, callee, if_successes, calls, inputs,
                        input_count)) {
     return;
   }
@@ -660,7 +726,7 @@ void JSInliningHeuristic::CreateOrReuseDispatch(Node* node, Node* callee,
     // TODO(2206): Make comparison be based on underlying SharedFunctionInfo
     // instead of the target JSFunction reference directly.
     Node* target = jsgraph()->Constant(candidate.functions[i].value());
-    if (i != (num_calls - 1)) {
+    if (i != (num_calls - 1) || candidate.has_generic_fallback) {
       Node* check =
           graph()->NewNode(simplified()->ReferenceEqual(), callee, target);
       Node* branch =
@@ -689,6 +755,18 @@ void JSInliningHeuristic::CreateOrReuseDispatch(Node* node, Node* callee,
     calls[i] = if_successes[i] =
         graph()->NewNode(node->op(), input_count, inputs);
   }
+
+  // All other targets go through a generic call on the remaining path.
+  if (candidate.has_generic_fallback) {
+    if (node->opcode() == IrOpcode::kJSConstruct) {
+      JSConstructNode n(node);
+      inputs[n.NewTargetIndex()] = node->InputAt(n.NewTargetIndex());
+    }
+    inputs[JSCallOrConstructNode::TargetIndex()] = callee;
+    inputs[input_count - 1] = fallthrough_control;
+    calls[num_calls] = if_successes[num_calls] =
+        graph()->NewNode(node->op(), input_count, inputs);
+  }
 }
 
 Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
@@ -698,7 +776,7 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
 #if V8_ENABLE_WEBASSEMBLY
   DCHECK_NE(node->opcode(), IrOpcode::kJSWasmCall);
 #endif  // V8_ENABLE_WEBASSEMBLY
-  if (num_calls == 1) {
+  if (num_calls == 1 && !candidate.has_generic_fallback) {
     Reduction const reduction = inliner_.ReduceJSCall(node);
     if (reduction.Changed()) {
       total_inlined_bytecode_size_ += candidate.bytecode[0].value().length();
@@ -707,10 +785,12 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
   }
 
   // Expand the JSCall/JSConstruct node to a subgraph first if
-  // we have multiple known target functions.
-  DCHECK_LT(1, num_calls);
-  Node* calls[kMaxCallPolymorphism + 1];
-  Node* if_successes[kMaxCallPolymorphism];
+  // we have multiple known target functions, or a generic fallback call.
+  int const num_dispatched =
+      num_calls + (candidate.has_generic_fallback ? 1 : 0);
+  DCHECK_LT(1, num_dispatched);
+  Node* calls[kMaxCallPolymorphism + 2];
+  Node* if_successes[kMaxCallPolymorphism + 1];
   Node* callee = NodeProperties::GetValueInput(node, 0);
 
   // Setup the inputs for the cloned call nodes.
@@ -727,38 +807,40 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
   // Check if we have an exception projection for the call {node}.
   Node* if_exception = nullptr;
   if (NodeProperties::IsExceptionalCall(node, &if_exception)) {
-    Node* if_exceptions[kMaxCallPolymorphism + 1];
-    for (int i = 0; i < num_calls; ++i) {
+    Node* if_exceptions[kMaxCallPolymorphism + 2];
+    for (int i = 0; i < num_dispatched; ++i) {
       if_successes[i] = graph()->NewNode(common()->IfSuccess(), calls[i]);
       if_exceptions[i] =
           graph()->NewNode(common()->IfException(), calls[i], calls[i]);
     }
 
     // Morph the {if_exception} projection into a join.
-    Node* exception_control =
-        graph()->NewNode(common()->Merge(num_calls), num_calls, if_exceptions);
-    if_exceptions[num_calls] = exception_control;
-    Node* exception_effect = graph()->NewNode(common()->EffectPhi(num_calls),
-                                              num_calls + 1, if_exceptions);
+    Node* exception_control = graph()->NewNode(
+        common()->Merge(num_dispatched), num_dispatched, if_exceptions);
+    if_exceptions[num_dispatched] = exception_control;
+    Node* exception_effect =
+        graph()->NewNode(common()->EffectPhi(num_dispatched),
+                         num_dispatched + 1, if_exceptions);
     Node* exception_value = graph()->NewNode(
-        common()->Phi(MachineRepresentation::kTagged, num_calls), num_calls + 1,
-        if_exceptions);
+        common()->Phi(MachineRepresentation::kTagged, num_dispatched),
+        num_dispatched + 1, if_exceptions);
     ReplaceWithValue(if_exception, exception_value, exception_effect,
                      exception_control);
   }
 
   // Morph the original call site into a join of the dispatched call sites.
-  Node* control =
-      graph()->NewNode(common()->Merge(num_calls), num_calls, if_successes);
-  calls[num_calls] = control;
-  Node* effect =
-      graph()->NewNode(common()->EffectPhi(num_calls), num_calls + 1, calls);
-  Node* value =
-      graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, num_calls),
-                       num_calls + 1, calls);
+  Node* control = graph()->NewNode(common()->Merge(num_dispatched),
+                                   num_dispatched, if_successes);
+  calls[num_dispatched] = control;
+  Node* effect = graph()->NewNode(common()->EffectPhi(num_dispatched),
+                                  num_dispatched + 1, calls);
+  Node* value = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, num_dispatched),
+      num_dispatched + 1, calls);
   ReplaceWithValue(node, value, effect, control);
 
-  // Inline the individual, cloned call sites.
+  // Inline the individual, cloned call sites. The generic fallback call, if
+  // any, is left alone.
   for (int i = 0; i < num_calls && total_inlined_bytecode_size_ <
                                        max_inlined_bytecode_size_absolute_;
        ++i) {
@@ -806,7 +888,9 @@ void JSInliningHeuristic::PrintCandidates() {
   for (const Candidate& candidate : candidates_) {
     os << "- candidate: " << candidate.node->op()->mnemonic() << " node #"
        << candidate.node->id() << " with frequency " << candidate.frequency
-       << ", " << candidate.num_functions << " target(s):" << std::endl;
+       << ", " << candidate.num_functions << " target(s)"
+       << (candidate.has_generic_fallback ? " and a generic fallback" : "")
+       << ":" << std::endl;
     for (int i = 0; i < candidate.num_functions; ++i) {
       SharedFunctionInfoRef shared = candidate.functions[i].has_value()
                                          ? candidate.functions[i]->shared()
@@ -65,6 +65,9 @@ class JSInliningHeuristic final : public AdvancedReducer {
     // we use {num_functions == 1 && functions[0].is_null()} as an indicator.
     base::Optional<SharedFunctionInfoRef> shared_info;
     int num_functions;
+    // Whether {functions} are only the dominant targets of the call site, so
+    // that the dispatch needs a generic call for all other targets.
+    bool has_generic_fallback = false;
     Node* node = nullptr;     // The call site at which to inline.
     CallFrequency frequency;  // Relative frequency of this call site.
     int total_size = 0;
@@ -94,6 +97,8 @@ class JSInliningHeuristic final : public AdvancedReducer {
   Node* DuplicateStateValuesAndRename(Node* state_values, Node* from, Node* to,
                                       StateCloneMode mode);
   Candidate CollectFunctions(Node* node, int functions_size);
+  void CollectDominantFunctions(Node* callee, int functions_size,
+                                Candidate* out);
 
   CommonOperatorBuilder* common() const;
   Graph* graph() const;
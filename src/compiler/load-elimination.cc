@@ -1253,6 +1253,32 @@ Reduction LoadElimination::UpdateState(Node* node, AbstractState const* state) {
   return NoChange();
 }
 
+bool LoadElimination::LoopPreservesMaps(Node* effect_phi, Node* object,
+                                        ZoneHandleSet<Map> const& maps) const {
+  DCHECK_EQ(IrOpcode::kEffectPhi, effect_phi->opcode());
+  AbstractState const* state = empty_state()->SetMaps(object, maps, zone());
+  state = ComputeLoopState(effect_phi, state);
+  ZoneHandleSet<Map> object_maps;
+  return state->LookupMaps(object, &object_maps) && object_maps == maps;
+}
+
+bool LoadElimination::LoopPreservesField(Node* effect_phi, Node* object,
+                                         FieldAccess const& access) const {
+  DCHECK_EQ(IrOpcode::kEffectPhi, effect_phi->opcode());
+  if (access.offset == HeapObject::kMapOffset) return false;
+  IndexRange field_index = FieldIndexOf(access);
+  if (field_index == IndexRange::Invalid()) return false;
+  // Track the field with a placeholder value and check whether it survives
+  // the writes in the loop.
+  FieldInfo info(object, access.machine_type.representation(), access.name,
+                 access.const_field_info);
+  AbstractState const* state =
+      empty_state()->AddField(object, field_index, info, zone());
+  state = ComputeLoopState(effect_phi, state);
+  return state->LookupField(object, field_index, access.const_field_info) !=
+         nullptr;
+}
+
 LoadElimination::AbstractState const*
 LoadElimination::ComputeLoopStateForStoreField(
     Node* current, LoadElimination::AbstractState const* state,
@@ -40,6 +40,15 @@ class V8_EXPORT_PRIVATE LoadElimination final
 
   Reduction Reduce(Node* node) final;
 
+  // Support for loop-invariant code motion: Whether no node of the loop with
+  // the {effect_phi} may change the {maps} of {object} or the field {access} of
+  // {object}, respectively, according to the same alias analysis that computes
+  // the state at loop headers.
+  bool LoopPreservesMaps(Node* effect_phi, Node* object,
+                         ZoneHandleSet<Map> const& maps) const;
+  bool LoopPreservesField(Node* effect_phi, Node* object,
+                          FieldAccess const& access) const;
+
  private:
   static const size_t kMaxTrackedElements = 8;
 
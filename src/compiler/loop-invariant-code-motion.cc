@@ -0,0 +1,192 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-invariant-code-motion.h"
+
+#include <algorithm>
+
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+void LoopInvariantCodeMotion::HoistLoopInvariantLoads() {
+  for (LoopTree::Loop* loop : loop_tree_->outer_loops()) {
+    VisitLoop(loop);
+  }
+}
+
+void LoopInvariantCodeMotion::VisitLoop(LoopTree::Loop* loop) {
+  // Process inner loops first, so that loads hoisted out of them become
+  // visible to the enclosing loop.
+  for (LoopTree::Loop* inner_loop : loop->children()) {
+    VisitLoop(inner_loop);
+  }
+  HoistFromLoop(loop);
+}
+
+bool LoopInvariantCodeMotion::IsDefinedOutside(LoopTree::Loop* loop,
+                                               Node* node) {
+  return !loop_tree_->Contains(loop, node);
+}
+
+bool LoopInvariantCodeMotion::CanDeoptimizeAtLoopEntry(Node* effect_phi) {
+  // A check that is moved to the loop entry deoptimizes to the frame state of
+  // the closest {Checkpoint} in front of the loop. This is only correct if
+  // there are no side effects between the two.
+  Node* effect =
+      NodeProperties::GetEffectInput(effect_phi, kAssumedLoopEntryIndex);
+  while (effect->opcode() != IrOpcode::kCheckpoint) {
+    if (!effect->op()->HasProperty(Operator::kNoWrite)) return false;
+    if (effect->op()->EffectInputCount() != 1) return false;
+    effect = NodeProperties::GetEffectInput(effect);
+  }
+  return true;
+}
+
+void LoopInvariantCodeMotion::HoistFromLoop(LoopTree::Loop* loop) {
+  Node* const loop_node = loop_tree_->GetLoopControl(loop);
+  Node* effect_phi = nullptr;
+  for (Node* use : loop_node->uses()) {
+    if (use->opcode() == IrOpcode::kEffectPhi) {
+      effect_phi = use;
+      break;
+    }
+  }
+  if (effect_phi == nullptr) return;
+
+  // Control nodes of the straight-line code visited so far.
+  ZoneVector<Node*> controls(tmp_zone_);
+  controls.push_back(loop_node);
+  auto is_straight_line_control = [&](Node* control) {
+    return std::find(controls.begin(), controls.end(), control) !=
+           controls.end();
+  };
+  // The loop body is entered through the branches that exit the loop.
+  auto is_loop_exit_projection = [&](Node* control) {
+    if (control->opcode() != IrOpcode::kIfTrue &&
+        control->opcode() != IrOpcode::kIfFalse) {
+      return false;
+    }
+    Node* branch = NodeProperties::GetControlInput(control);
+    if (!is_straight_line_control(NodeProperties::GetControlInput(branch))) {
+      return false;
+    }
+    for (Node* projection : branch->uses()) {
+      if (projection != control && !loop_tree_->Contains(loop, projection)) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // Objects with a single map that is checked by a hoisted {CheckMaps}.
+  ZoneVector<Node*> checked_objects(tmp_zone_);
+  auto has_checked_map = [&](Node* object) {
+    return std::find(checked_objects.begin(), checked_objects.end(),
+                     object) != checked_objects.end();
+  };
+  bool const can_deoptimize_at_entry = CanDeoptimizeAtLoopEntry(effect_phi);
+  // Whether the walk has left the part of the loop that is executed on every
+  // iteration. Checks are only hoisted from that part, as they would otherwise
+  // deoptimize speculatively.
+  bool executed_on_every_iteration = true;
+
+  auto hoist = [&](Node* node, Node* current) {
+    // Unlink {node} from the loop's effect chain and re-insert it right before
+    // the loop entry.
+    for (Edge edge : node->use_edges()) {
+      if (NodeProperties::IsEffectEdge(edge)) edge.UpdateTo(current);
+    }
+    NodeProperties::ReplaceEffectInput(
+        node,
+        NodeProperties::GetEffectInput(effect_phi, kAssumedLoopEntryIndex));
+    NodeProperties::ReplaceControlInput(
+        node,
+        NodeProperties::GetControlInput(loop_node, kAssumedLoopEntryIndex));
+    NodeProperties::ReplaceEffectInput(effect_phi, node,
+                                       kAssumedLoopEntryIndex);
+  };
+
+  Node* current = effect_phi;
+  while (true) {
+    // Find the unique effect successor of {current} inside of the loop; stop
+    // where the effect chain forks.
+    Node* next = nullptr;
+    for (Edge edge : current->use_edges()) {
+      if (!NodeProperties::IsEffectEdge(edge)) continue;
+      Node* use = edge.from();
+      if (use->opcode() == IrOpcode::kTerminate) continue;
+      if (!loop_tree_->Contains(loop, use)) {
+        executed_on_every_iteration = false;
+        continue;
+      }
+      if (next != nullptr) return;
+      next = use;
+    }
+    if (next == nullptr) return;
+    if (next->op()->EffectInputCount() != 1) return;
+    if (next->op()->ControlInputCount() != 1) return;
+    Node* control = NodeProperties::GetControlInput(next);
+    if (!is_straight_line_control(control)) {
+      if (control->opcode() == IrOpcode::kIfSuccess &&
+          is_straight_line_control(NodeProperties::GetControlInput(control))) {
+        controls.push_back(control);
+      } else if (is_loop_exit_projection(control)) {
+        controls.push_back(control);
+        executed_on_every_iteration = false;
+      } else {
+        return;
+      }
+    }
+
+    if (next->opcode() == IrOpcode::kLoadField) {
+      Node* object = NodeProperties::GetValueInput(next, 0);
+      bool invariant = true;
+      for (int i = 0; i < next->op()->ValueInputCount(); ++i) {
+        if (!IsDefinedOutside(loop, NodeProperties::GetValueInput(next, i))) {
+          invariant = false;
+          break;
+        }
+      }
+      if (invariant &&
+          (executed_on_every_iteration || has_checked_map(object)) &&
+          alias_analysis_.LoopPreservesField(effect_phi, object,
+                                             FieldAccessOf(next->op()))) {
+        hoist(next, current);
+        continue;
+      }
+    } else if (next->opcode() == IrOpcode::kCheckMaps) {
+      Node* object = NodeProperties::GetValueInput(next, 0);
+      ZoneHandleSet<Map> const& maps = CheckMapsParametersOf(next->op()).maps();
+      if (executed_on_every_iteration && can_deoptimize_at_entry &&
+          IsDefinedOutside(loop, object) &&
+          alias_analysis_.LoopPreservesMaps(effect_phi, object, maps)) {
+        hoist(next, current);
+        if (maps.size() == 1) checked_objects.push_back(object);
+        continue;
+      }
+    }
+
+    // Other nodes may only be passed if they neither write nor deoptimize, as
+    // the latter might guard the following nodes. The stack check can only
+    // deoptimize lazily and is thus fine to pass.
+    if (next->opcode() != IrOpcode::kCheckpoint) {
+      if (!next->op()->HasProperty(Operator::kNoWrite)) return;
+      if (!next->op()->HasProperty(Operator::kNoDeopt) &&
+          next->opcode() != IrOpcode::kJSStackCheck) {
+        return;
+      }
+    }
+    if (next->op()->ControlOutputCount() > 0) controls.push_back(next);
+    current = next;
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
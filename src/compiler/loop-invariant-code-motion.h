@@ -0,0 +1,59 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+#define V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+
+#include "src/base/compiler-specific.h"
+#include "src/common/globals.h"
+#include "src/compiler/load-elimination.h"
+#include "src/compiler/loop-analysis.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class JSGraph;
+
+// Hoists loop-invariant field loads and map checks out of loops. Pure nodes
+// already float and are placed outside of loops by the scheduler; loads and
+// checks however are pinned to the effect chain. Starting at the loop header,
+// the pass walks the loop's effect chain as long as it is straight-line code
+// and moves
+//  - a {CheckMaps} of an object defined outside of the loop to the loop entry
+//    if it is executed on every iteration and the loop cannot change the
+//    object's maps,
+//  - a {LoadField} whose inputs are defined outside of the loop to the loop
+//    entry if the loop cannot write the field. Loads that are not executed on
+//    every iteration are only hoisted if the object's map is fixed by a hoisted
+//    {CheckMaps}.
+// Whether the loop may change maps or fields is decided by the alias analysis
+// of {LoadElimination}. Running this before load elimination allows the
+// hoisted nodes to be eliminated against dominating ones in front of the loop.
+class V8_EXPORT_PRIVATE LoopInvariantCodeMotion {
+ public:
+  LoopInvariantCodeMotion(LoopTree* loop_tree, JSGraph* jsgraph, Zone* tmp_zone)
+      : loop_tree_(loop_tree),
+        tmp_zone_(tmp_zone),
+        alias_analysis_(nullptr, jsgraph, tmp_zone) {}
+
+  void HoistLoopInvariantLoads();
+
+ private:
+  void VisitLoop(LoopTree::Loop* loop);
+  void HoistFromLoop(LoopTree::Loop* loop);
+  bool IsDefinedOutside(LoopTree::Loop* loop, Node* node);
+  bool CanDeoptimizeAtLoopEntry(Node* effect_phi);
+
+  LoopTree* const loop_tree_;
+  Zone* const tmp_zone_;
+  // Only used for its loop queries, never as a reducer.
+  LoadElimination const alias_analysis_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
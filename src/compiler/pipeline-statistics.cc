@@ -89,6 +89,14 @@ void PipelineStatistics::EndPhaseKind() {
                    TRACE_STR_COPY(diff.AsJSON().c_str()));
 }
 
+void PipelineStatistics::RecordSkippedPhase(const char* phase_name,
+                                            const char* reason) {
+  TRACE_EVENT_INSTANT2(kTraceCategory, "V8.TFSkippedPhase",
+                       TRACE_EVENT_SCOPE_THREAD, "phase", phase_name, "reason",
+                       reason);
+  compilation_stats_->RecordSkippedPhase(phase_name, reason);
+}
+
 void PipelineStatistics::BeginPhase(const char* phase_name) {
   TRACE_EVENT_BEGIN1(kTraceCategory, phase_name, "kind",
                      CodeKindToString(code_kind_));
@@ -31,6 +31,9 @@ class PipelineStatistics : public Malloced {
   void BeginPhaseKind(const char* phase_kind_name);
   void EndPhaseKind();
 
+  // Records that the optional phase {phase_name} was skipped for {reason}.
+  void RecordSkippedPhase(const char* phase_name, const char* reason);
+
   // We log detailed phase information about the pipeline
   // in both the v8.turbofan and the v8.wasm.turbofan categories.
   static constexpr char kTraceCategory[] =
@@ -56,6 +56,7 @@
 #include "src/compiler/js-typed-lowering.h"
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/loop-analysis.h"
+#include "src/compiler/loop-invariant-code-motion.h"
 #include "src/compiler/loop-peeling.h"
 #include "src/compiler/loop-unrolling.h"
 #include "src/compiler/loop-variable-optimizer.h"
@@ -569,6 +570,38 @@ class PipelineData {
     }
   }
 
+  // Returns whether the optional phase {phase_name} still fits into the
+  // budget of this job. Graphs that grew too large or jobs that hold too much
+  // zone memory skip optional phases, and the reason is recorded in the
+  // pipeline statistics.
+  bool CanAffordOptionalPhase(const char* phase_name) {
+    if (!FLAG_turbo_compile_budget || !info()->IsOptimizing()) return true;
+    size_t const node_count = graph()->NodeCount();
+    size_t const zone_bytes = zone_stats()->GetCurrentAllocatedBytes();
+    const char* reason = nullptr;
+    if (node_count > static_cast<size_t>(FLAG_turbo_budget_max_nodes)) {
+      reason = "graph size";
+    } else if (zone_bytes >
+               static_cast<size_t>(FLAG_turbo_budget_max_zone_mb) * MB) {
+      reason = "zone memory";
+    } else {
+      return true;
+    }
+    if (pipeline_statistics() != nullptr) {
+      pipeline_statistics()->RecordSkippedPhase(phase_name, reason);
+    }
+    if (FLAG_trace_turbo_budget) {
+      StdoutStream{} << "[compile budget] skipping " << phase_name << " for "
+                     << debug_name() << " (" << reason << ": " << node_count
+                     << " nodes, " << zone_bytes << " zone bytes)"
+                     << std::endl;
+    }
+    return false;
+  }
+
+  bool instruction_scheduling() const { return instruction_scheduling_; }
+  void disable_instruction_scheduling() { instruction_scheduling_ = false; }
+
   const char* debug_name() const { return debug_name_.get(); }
 
   const ProfileDataFromFile* profile_data() const { return profile_data_; }
@@ -668,6 +701,7 @@ class PipelineData {
   const ProfileDataFromFile* profile_data_ = nullptr;
 
   bool has_js_wasm_calls_ = false;
+  bool instruction_scheduling_ = FLAG_turbo_instruction_scheduling;
 };
 
 class PipelineImpl final {
@@ -1200,6 +1234,11 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
 
   pipeline_.InitializeHeapBroker();
 
+  if (FLAG_turbo_context_pretenuring && compilation_info()->inlining()) {
+    data_.broker()->CollectContextAllocationSites(
+        compilation_info()->closure());
+  }
+
   if (!data_.broker()->is_concurrent_inlining()) {
     if (!pipeline_.CreateGraph()) {
       CHECK(!isolate->has_pending_exception());
@@ -1657,6 +1696,17 @@ struct LoopPeelingPhase {
   }
 };
 
+struct LoopInvariantCodeMotionPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(LoopInvariantCodeMotion)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(
+        data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
+    LoopInvariantCodeMotion(loop_tree, data->jsgraph(), temp_zone)
+        .HoistLoopInvariantLoads();
+  }
+};
+
 #if V8_ENABLE_WEBASSEMBLY
 struct WasmInliningPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(WasmInlining)
@@ -2245,7 +2295,7 @@ struct InstructionSelectionPhase {
             ? InstructionSelector::kAllSourcePositions
             : InstructionSelector::kCallSourcePositions,
         InstructionSelector::SupportedFeatures(),
-        FLAG_turbo_instruction_scheduling
+        data->instruction_scheduling()
             ? InstructionSelector::kEnableScheduling
             : InstructionSelector::kDisableScheduling,
         data->assembler_options().enable_root_relative_access
@@ -2759,7 +2809,9 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   Run<TypedLoweringPhase>();
   RunPrintAndVerify(TypedLoweringPhase::phase_name());
 
-  if (data->info()->loop_peeling()) {
+  // Loop peeling degrades to plain loop exit elimination when over budget.
+  if (data->info()->loop_peeling() &&
+      data->CanAffordOptionalPhase(LoopPeelingPhase::phase_name())) {
     Run<LoopPeelingPhase>();
     RunPrintAndVerify(LoopPeelingPhase::phase_name(), true);
   } else {
@@ -2767,13 +2819,22 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     RunPrintAndVerify(LoopExitEliminationPhase::phase_name(), true);
   }
 
-  if (FLAG_turbo_load_elimination) {
+  if (FLAG_turbo_loop_invariant_code_motion &&
+      data->CanAffordOptionalPhase(
+          LoopInvariantCodeMotionPhase::phase_name())) {
+    Run<LoopInvariantCodeMotionPhase>();
+    RunPrintAndVerify(LoopInvariantCodeMotionPhase::phase_name());
+  }
+
+  if (FLAG_turbo_load_elimination &&
+      data->CanAffordOptionalPhase(LoadEliminationPhase::phase_name())) {
     Run<LoadEliminationPhase>();
     RunPrintAndVerify(LoadEliminationPhase::phase_name());
   }
   data->DeleteTyper();
 
-  if (FLAG_turbo_escape) {
+  if (FLAG_turbo_escape &&
+      data->CanAffordOptionalPhase(EscapeAnalysisPhase::phase_name())) {
     Run<EscapeAnalysisPhase>();
     if (data->compilation_failed()) {
       info()->AbortOptimization(
@@ -3576,6 +3637,12 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
   if (!data->frame()) {
     data->InitializeFrameData(call_descriptor);
   }
+  // Instruction scheduling is optional and is dropped when over budget.
+  if (data->instruction_scheduling() &&
+      !data->CanAffordOptionalPhase("V8.TFInstructionScheduling")) {
+    data->disable_instruction_scheduling();
+  }
+
   // Select and schedule instructions covering the scheduled graph.
   Run<InstructionSelectionPhase>(linkage);
   if (data->compilation_failed()) {
@@ -1813,6 +1813,7 @@ class RepresentationSelector {
             UNREACHABLE();
           case CTypeInfo::Type::kBool:
             return UseInfo::Bool();
+          case CTypeInfo::Type::kUint8:
           case CTypeInfo::Type::kInt32:
           case CTypeInfo::Type::kUint32:
             return UseInfo::CheckedNumberAsWord32(feedback);
@@ -1827,6 +1828,7 @@ class RepresentationSelector {
           case CTypeInfo::Type::kFloat64:
             return UseInfo::CheckedNumberAsFloat64(kDistinguishZeros, feedback);
           case CTypeInfo::Type::kV8Value:
+          case CTypeInfo::Type::kSeqOneByteString:
           case CTypeInfo::Type::kApiObject:
             return UseInfo::AnyTagged();
         }
@@ -3159,14 +3161,12 @@ class RepresentationSelector {
         return;
       }
       case IrOpcode::kStringConcat: {
-        // TODO(turbofan): We currently depend on having this first length input
-        // to make sure that the overflow check is properly scheduled before the
-        // actual string concatenation. We should also use the length to pass it
-        // to the builtin or decide in optimized code how to construct the
-        // resulting string (i.e. cons string or sequential string).
-        ProcessInput<T>(node, 0, UseInfo::TaggedSigned());  // length
-        ProcessInput<T>(node, 1, UseInfo::AnyTagged());     // first
-        ProcessInput<T>(node, 2, UseInfo::AnyTagged());     // second
+        // The length input makes sure that the overflow check is scheduled
+        // before the actual string concatenation, and is used to decide in
+        // optimized code whether to construct a ConsString inline.
+        ProcessInput<T>(node, 0, UseInfo::TruncatingWord32());  // length
+        ProcessInput<T>(node, 1, UseInfo::AnyTagged());         // first
+        ProcessInput<T>(node, 2, UseInfo::AnyTagged());         // second
         SetOutput<T>(node, MachineRepresentation::kTaggedPointer);
         return;
       }
@@ -3963,6 +3963,7 @@ class RepresentationSelector {
       case IrOpcode::kMerge:
       case IrOpcode::kThrow:
       case IrOpcode::kBeginRegion:
+      case IrOpcode::kRetain:
       case IrOpcode::kProjection:
       case IrOpcode::kOsrValue:
       case IrOpcode::kArgumentsElementsState:
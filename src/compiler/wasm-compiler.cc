@@ -5599,17 +5599,45 @@ Node* WasmGraphBuilder::ArrayNewWithRtt(uint32_t array_index,
   return a;
 }
 
+// array.init with up to this many elements is allocated inline. Longer arrays
+// are allocated by a builtin: their initializing stores dominate the cost, and
+// they are neither worth folding with neighboring allocations nor candidates
+// for escape analysis.
+constexpr int kMaxInlineArrayInitLength = 64;
+
 Node* WasmGraphBuilder::ArrayInit(uint32_t array_index,
                                   const wasm::ArrayType* type, Node* rtt,
                                   base::Vector<Node*> elements) {
   wasm::ValueType element_type = type->element_type();
-  // TODO(7748): Consider using gasm_->Allocate().
-  Node* array =
-      gasm_->CallBuiltin(Builtin::kWasmAllocateArray_Uninitialized,
-                         Operator::kNoDeopt | Operator::kNoThrow, rtt,
-                         Int32Constant(static_cast<int32_t>(elements.size())),
-                         Int32Constant(element_type.element_size_bytes()));
-  for (int i = 0; i < static_cast<int>(elements.size()); i++) {
+  int length = static_cast<int>(elements.size());
+  DCHECK_LE(length, wasm::kV8MaxWasmArrayInitLength);
+  Node* array;
+  if (length <= kMaxInlineArrayInitLength) {
+    // The array has a statically known size, so allocate it inline like a
+    // struct. This allows the memory optimizer to fold it with neighboring
+    // allocations, and WasmEscapeAnalysis to remove it once load elimination
+    // has forwarded all stored elements to their loads. Splitting an array
+    // which still has other uses into scalars (scalar replacement) is not
+    // implemented, neither for arrays nor for structs.
+    int size = WasmArray::kHeaderSize +
+               RoundUp(length * element_type.element_size_bytes(), kTaggedSize);
+    array = gasm_->Allocate(size);
+    gasm_->StoreMap(array, rtt);
+    gasm_->InitializeImmutableInObject(
+        ObjectAccess(MachineType::TaggedPointer(), kNoWriteBarrier), array,
+        wasm::ObjectAccess::ToTagged(JSReceiver::kPropertiesOrHashOffset),
+        LOAD_ROOT(EmptyFixedArray, empty_fixed_array));
+    gasm_->InitializeImmutableInObject(
+        ObjectAccess(MachineType::Uint32(), kNoWriteBarrier), array,
+        wasm::ObjectAccess::ToTagged(WasmArray::kLengthOffset),
+        Int32Constant(length));
+  } else {
+    array = gasm_->CallBuiltin(
+        Builtin::kWasmAllocateArray_Uninitialized,
+        Operator::kNoDeopt | Operator::kNoThrow, rtt, Int32Constant(length),
+        Int32Constant(element_type.element_size_bytes()));
+  }
+  for (int i = 0; i < length; i++) {
     Node* offset =
         gasm_->WasmArrayElementOffset(Int32Constant(i), element_type);
     if (type->mutability()) {
@@ -6286,6 +6314,29 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
 
   Node* BuildChangeTaggedToFloat64(Node* value, Node* context,
                                    Node* frame_state) {
+    // Numbers passed across the JS/Wasm boundary are usually Smis or
+    // HeapNumbers, so inline those conversions and only call the builtin for
+    // other values.
+    auto builtin = gasm_->MakeDeferredLabel();
+    auto not_smi = gasm_->MakeLabel();
+    auto done = gasm_->MakeLabel(MachineRepresentation::kFloat64);
+
+    gasm_->GotoIfNot(IsSmi(value), &not_smi);
+    gasm_->Goto(&done, SmiToFloat64(value));
+
+    gasm_->Bind(&not_smi);
+    Node* map = gasm_->LoadMap(value);
+    Node* heap_number_map = LOAD_ROOT(HeapNumberMap, heap_number_map);
+#if V8_MAP_PACKING
+    Node* is_heap_number = gasm_->WordEqual(heap_number_map, map);
+#else
+    Node* is_heap_number = gasm_->TaggedEqual(heap_number_map, map);
+#endif
+    gasm_->GotoIfNot(is_heap_number, &builtin);
+    gasm_->Goto(&done, HeapNumberToFloat64(value));
+
+    // Otherwise, call builtin which changes the value to Float64.
+    gasm_->Bind(&builtin);
     CommonOperatorBuilder* common = mcgraph()->common();
     Node* target = GetTargetForBuiltinCall(wasm::WasmCode::kWasmTaggedToFloat64,
                                            Builtin::kWasmTaggedToFloat64);
@@ -6304,7 +6355,9 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
                      : gasm_->Call(tagged_to_float64_operator_.get(), target,
                                    value, context);
     SetSourcePosition(call, 1);
-    return call;
+    gasm_->Goto(&done, call);
+    gasm_->Bind(&done);
+    return done.PhiAt(0);
   }
 
   int AddArgumentNodes(base::Vector<Node*> args, int pos, int param_count,
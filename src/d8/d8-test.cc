@@ -231,6 +231,11 @@ class FastCApiObject {
   template <typename T>
   static const FastApiTypedArray<T>* AnyCTypeToTypedArray(AnyCType arg);
 
+  template <>
+  const FastApiTypedArray<uint8_t>* AnyCTypeToTypedArray<uint8_t>(
+      AnyCType arg) {
+    return arg.uint8_ta_value;
+  }
   template <>
   const FastApiTypedArray<int32_t>* AnyCTypeToTypedArray<int32_t>(
       AnyCType arg) {
@@ -322,12 +327,15 @@ class FastCApiObject {
     size_t length = typed_array_arg->Length();
 
     void* data = typed_array_arg->Buffer()->GetBackingStore()->Data();
-    if (typed_array_arg->IsInt32Array() || typed_array_arg->IsUint32Array() ||
+    if (typed_array_arg->IsUint8Array() || typed_array_arg->IsInt32Array() ||
+        typed_array_arg->IsUint32Array() ||
         typed_array_arg->IsBigInt64Array() ||
         typed_array_arg->IsBigUint64Array()) {
       int64_t sum = 0;
       for (unsigned i = 0; i < length; ++i) {
-        if (typed_array_arg->IsInt32Array()) {
+        if (typed_array_arg->IsUint8Array()) {
+          sum += static_cast<uint8_t*>(data)[i];
+        } else if (typed_array_arg->IsInt32Array()) {
           sum += static_cast<int32_t*>(data)[i];
         } else if (typed_array_arg->IsUint32Array()) {
           sum += static_cast<uint32_t*>(data)[i];
@@ -411,6 +419,62 @@ class FastCApiObject {
     args.GetReturnValue().Set(Number::New(isolate, sum));
   }
 
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType SumOneByteStringFastCallbackPatch(AnyCType receiver,
+                                                    AnyCType should_fallback,
+                                                    AnyCType string_arg,
+                                                    AnyCType options) {
+    AnyCType ret;
+    ret.uint32_value = SumOneByteStringFastCallback(
+        receiver.object_value, should_fallback.bool_value,
+        *string_arg.string_value, *options.options_value);
+    return ret;
+  }
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+
+  static uint32_t SumOneByteStringFastCallback(
+      v8::Local<v8::Object> receiver, bool should_fallback,
+      const FastOneByteString& string_arg, FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_FALLBACK(0);
+    self->fast_call_count_++;
+
+    if (should_fallback) {
+      options.fallback = 1;
+      return 0;
+    }
+
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < string_arg.length; ++i) {
+      sum += static_cast<uint8_t>(string_arg.data[i]);
+    }
+    return sum;
+  }
+  static void SumOneByteStringSlowCallback(
+      const FunctionCallbackInfo<Value>& args) {
+    Isolate* isolate = args.GetIsolate();
+
+    FastCApiObject* self = UnwrapObject(args.This());
+    CHECK_SELF_OR_THROW();
+    self->slow_call_count_++;
+
+    HandleScope handle_scope(isolate);
+
+    if (args.Length() < 2 || !args[1]->IsString()) {
+      isolate->ThrowError("This method expects a string as a second argument.");
+      return;
+    }
+
+    // Sum the UTF-16 code units, which matches the fast path for strings that
+    // only contain one-byte characters.
+    String::Value value(isolate, args[1]);
+    uint32_t sum = 0;
+    for (int i = 0; i < value.length(); ++i) {
+      sum += (*value)[i];
+    }
+    args.GetReturnValue().Set(Number::New(isolate, sum));
+  }
+
 #ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
   static AnyCType AddAll32BitIntFastCallback_6ArgsPatch(
       AnyCType receiver, AnyCType should_fallback, AnyCType arg1_i32,
@@ -663,6 +727,17 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
             signature, 1, ConstructorBehavior::kThrow,
             SideEffectType::kHasSideEffect, &add_all_seq_c_func));
 
+    CFunction add_all_uint8_typed_array_c_func = CFunction::Make(
+        FastCApiObject::AddAllTypedArrayFastCallback<uint8_t>
+            V8_IF_USE_SIMULATOR(
+                FastCApiObject::AddAllTypedArrayFastCallbackPatch<uint8_t>));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_uint8_typed_array",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddAllTypedArraySlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &add_all_uint8_typed_array_c_func));
+
     CFunction add_all_int32_typed_array_c_func = CFunction::Make(
         FastCApiObject::AddAllTypedArrayFastCallback<int32_t>
             V8_IF_USE_SIMULATOR(
@@ -781,6 +856,16 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
             isolate, FastCApiObject::Add32BitIntSlowCallback, Local<Value>(),
             signature, 1, ConstructorBehavior::kThrow,
             SideEffectType::kHasSideEffect, &add_32bit_int_c_func));
+
+    CFunction sum_one_byte_string_c_func = CFunction::Make(
+        FastCApiObject::SumOneByteStringFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::SumOneByteStringFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "sum_one_byte_string",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::SumOneByteStringSlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &sum_one_byte_string_c_func));
     CFunction is_valid_api_object_c_func =
         CFunction::Make(FastCApiObject::IsFastCApiObjectFastCallback);
     api_obj_ctor->PrototypeTemplate()->Set(
@@ -46,6 +46,13 @@ void CompilationStatistics::RecordTotalStats(const BasicStats& stats) {
   total_stats_.Accumulate(stats);
 }
 
+void CompilationStatistics::RecordSkippedPhase(const char* phase_name,
+                                               const char* reason) {
+  base::MutexGuard guard(&record_mutex_);
+  std::string key = std::string(phase_name) + " (" + reason + ")";
+  skipped_phase_map_[key]++;
+}
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
@@ -171,6 +178,20 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
   if (!ps.machine_output) WriteFullLine(os);
   WriteLine(os, ps.machine_output, "totals", s.total_stats_, s.total_stats_);
 
+  if (!s.skipped_phase_map_.empty()) {
+    if (ps.machine_output) {
+      for (const auto& skipped : s.skipped_phase_map_) {
+        os << std::endl
+           << "\"" << skipped.first << "_skipped\"=" << skipped.second;
+      }
+    } else {
+      os << std::endl << "Phases skipped by the compile budget:" << std::endl;
+      for (const auto& skipped : s.skipped_phase_map_) {
+        os << "  " << skipped.first << ": " << skipped.second << std::endl;
+      }
+    }
+  }
+
   return os;
 }
 
@@ -54,6 +54,10 @@ class CompilationStatistics final : public Malloced {
 
   void RecordTotalStats(const BasicStats& stats);
 
+  // Counts a phase that was not run because the compilation job exceeded its
+  // budget for the given {reason}.
+  void RecordSkippedPhase(const char* phase_name, const char* reason);
+
  private:
   class TotalStats : public BasicStats {
    public:
@@ -80,10 +84,12 @@ class CompilationStatistics final : public Malloced {
   using PhaseKindStats = OrderedStats;
   using PhaseKindMap = std::map<std::string, PhaseKindStats>;
   using PhaseMap = std::map<std::string, PhaseStats>;
+  using SkippedPhaseMap = std::map<std::string, size_t>;
 
   TotalStats total_stats_;
   PhaseKindMap phase_kind_map_;
   PhaseMap phase_map_;
+  SkippedPhaseMap skipped_phase_map_;
   base::Mutex record_mutex_;
 };
 
@@ -1480,8 +1480,12 @@ int DisassemblerX64::AVXInstruction(byte* data) {
         AppendToBuffer(",%u", *current++);
         break;
       case 0x73:
-        AppendToBuffer("vps%sq %s,", sf_str[regop / 2],
-                       NameOfAVXRegister(vvvv));
+        if (regop == 3) {
+          AppendToBuffer("vpsrldq %s,", NameOfAVXRegister(vvvv));
+        } else {
+          AppendToBuffer("vps%sq %s,", sf_str[regop / 2],
+                         NameOfAVXRegister(vvvv));
+        }
         current += PrintRightAVXOperand(current);
         AppendToBuffer(",%u", *current++);
         break;
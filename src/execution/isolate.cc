@@ -3068,7 +3068,7 @@ Isolate* Isolate::Allocate(bool is_shared) {
   // IsolateAllocator allocates the memory for the Isolate object according to
   // the given allocation mode.
   std::unique_ptr<IsolateAllocator> isolate_allocator =
-      std::make_unique<IsolateAllocator>();
+      std::make_unique<IsolateAllocator>(is_shared);
   // Construct Isolate object in the allocated memory.
   void* isolate_ptr = isolate_allocator->isolate_memory();
   Isolate* isolate =
@@ -3887,7 +3887,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
                                        kShortBuiltinCallsOldSpaceSizeThreshold);
     if (COMPRESS_POINTERS_IN_SHARED_CAGE_BOOL) {
       std::shared_ptr<CodeRange> code_range =
-          CodeRange::GetProcessWideCodeRange();
+          CodeRange::GetProcessWideCodeRange(cage_base());
       if (code_range && code_range->embedded_blob_code_copy() != nullptr) {
         is_short_builtin_calls_enabled_ = true;
       }
@@ -28,6 +28,7 @@ static const int kOSRBytecodeSizeAllowancePerTick = 44;
 #define OPTIMIZATION_REASON_LIST(V)   \
   V(DoNotOptimize, "do not optimize") \
   V(HotAndStable, "hot and stable")   \
+  V(KnownHot, "known to be hot")      \
   V(SmallFunction, "small function")
 
 enum class OptimizationReason : uint8_t {
@@ -182,6 +183,12 @@ bool ShouldOptimizeAsSmallFunction(int bytecode_size, bool any_ic_changed) {
 
 }  // namespace
 
+// static
+int RuntimeProfiler::TicksForOptimization(int bytecode_length) {
+  return FLAG_ticks_before_optimization +
+         (bytecode_length / FLAG_bytecode_size_allowance_per_tick);
+}
+
 OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
                                                    BytecodeArray bytecode) {
   if (function.ActiveTierIsTurbofan()) {
@@ -191,11 +198,18 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
     return OptimizationReason::kDoNotOptimize;
   }
   const int ticks = function.feedback_vector().profiler_ticks();
-  const int ticks_for_optimization =
-      FLAG_ticks_before_optimization +
-      (bytecode.length() / FLAG_bytecode_size_allowance_per_tick);
+  const int ticks_for_optimization = TicksForOptimization(bytecode.length());
   if (ticks >= ticks_for_optimization) {
     return OptimizationReason::kHotAndStable;
+  } else if ((FLAG_code_cache_tiering_hints || FLAG_snapshot_tiering_hints) &&
+             ticks > 0 && function.shared().is_known_hot()) {
+    // The function got hot before, possibly in a previous run that produced
+    // the code cache or the snapshot. Don't wait for it to warm up again, a
+    // single tick worth of feedback is enough to start optimizing. Like the
+    // producers, the consumer has to opt in: a hint found in a cache or
+    // snapshot is ignored without one of the flags. The hint is dropped when
+    // the function deoptimizes, see Runtime_NotifyDeoptimized.
+    return OptimizationReason::kKnownHot;
   } else if (ShouldOptimizeAsSmallFunction(bytecode.length(),
                                            any_ic_changed_)) {
     // If no IC was patched since the last tick and this function is very
@@ -34,6 +34,10 @@ class RuntimeProfiler {
   void AttemptOnStackReplacement(UnoptimizedFrame* frame,
                                  int nesting_levels = 1);
 
+  // The number of profiler ticks after which a function with the given
+  // bytecode length is hot enough to be optimized by TurboFan.
+  static int TicksForOptimization(int bytecode_length);
+
  private:
   // Helper function called from MarkCandidatesForOptimization*
   void MarkCandidatesForOptimization(JavaScriptFrame* frame);
@@ -604,6 +604,9 @@ DEFINE_INT(bytecode_size_allowance_per_tick, 1100,
            "bytecode.length/X")
 DEFINE_INT(interrupt_budget, 132 * KB,
            "interrupt budget which should be used for the profiler counter")
+DEFINE_BOOL(code_cache_tiering_hints, false,
+            "record in code cache data which functions got optimized, and "
+            "optimize them after the first tick in runs consuming the cache")
 DEFINE_INT(
     max_bytecode_size_for_early_opt, 81,
     "Maximum bytecode length for a function to be optimized on the first tick")
@@ -861,6 +864,12 @@ DEFINE_INT(max_optimized_bytecode_size, 60 * KB,
            "the compiler to hit (release) assertions")
 DEFINE_FLOAT(min_inlining_frequency, 0.15, "minimum frequency for inlining")
 DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
+DEFINE_BOOL(inline_dominant_targets, false,
+            "for calls whose target is a phi with too many or partly unknown "
+            "function inputs, inline the known functions with the highest "
+            "overall invocation counts behind identity checks, with a "
+            "generic call for all other targets")
+DEFINE_IMPLICATION(inline_dominant_targets, polymorphic_inlining)
 DEFINE_BOOL(stress_inline, false,
             "set high thresholds for inlining to inline as much as possible")
 DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size, 999999)
@@ -875,6 +884,9 @@ DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
 DEFINE_BOOL(trace_osr, false, "trace on-stack replacement")
+DEFINE_BOOL(concurrent_osr, false,
+            "compile OSR code on a background thread and continue executing "
+            "unoptimized code until it is ready")
 DEFINE_BOOL(analyze_environment_liveness, true,
             "analyze liveness of environment slots and zap dead values")
 DEFINE_BOOL(trace_environment_liveness, false,
@@ -895,17 +907,36 @@ DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
+DEFINE_BOOL(turbo_loop_invariant_code_motion, false,
+            "hoist loop-invariant loads out of loops in TurboFan")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "TurboFan allocation folding")
+DEFINE_BOOL(turbo_context_pretenuring, false,
+            "track pretenuring feedback separately for literals that are "
+            "inlined into optimized code")
+DEFINE_NEG_NEG_IMPLICATION(allocation_site_pretenuring,
+                           turbo_context_pretenuring)
+// Off by default: The latency tables have not been validated on hardware yet.
+// Compare the InstructionScheduling and InstructionSchedulingEnabled
+// js-perf-test runs on each target before changing the default there.
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
                    turbo_instruction_scheduling)
+DEFINE_BOOL(turbo_compile_budget, true,
+            "skip optional TurboFan phases for jobs whose graph or zone memory "
+            "exceeds the compile budget")
+DEFINE_INT(turbo_budget_max_nodes, 300000,
+           "maximum graph size for running optional TurboFan phases")
+DEFINE_INT(turbo_budget_max_zone_mb, 384,
+           "maximum zone memory in MB for running optional TurboFan phases")
+DEFINE_BOOL(trace_turbo_budget, false,
+            "trace optional TurboFan phases skipped by the compile budget")
 DEFINE_BOOL(turbo_store_elimination, true,
             "enable store-store elimination in TurboFan")
 DEFINE_BOOL(trace_store_elimination, false, "trace store elimination")
@@ -1012,6 +1043,9 @@ DEFINE_BOOL(liftoff_only, false,
 DEFINE_IMPLICATION(liftoff_only, liftoff)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_tier_up)
 DEFINE_NEG_IMPLICATION(fuzzing, liftoff_only)
+DEFINE_BOOL(liftoff_loop_locals_in_registers, true,
+            "keep Wasm locals in registers across Liftoff loop headers if "
+            "register pressure allows")
 DEFINE_DEBUG_BOOL(
     enable_testing_opcode_in_wasm, false,
     "enables a testing opcode in wasm that is only implemented in TurboFan")
@@ -1241,7 +1275,18 @@ DEFINE_BOOL(trace_mutator_utilization, false,
 DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
+#if defined(CPPGC_YOUNG_GENERATION)
+DEFINE_BOOL(cppgc_young_generation, false,
+            "collect young C++ objects of CppHeap along with scavenges")
+#else
+DEFINE_BOOL_READONLY(cppgc_young_generation, false,
+                     "collect young C++ objects of CppHeap along with "
+                     "scavenges")
+#endif
 DEFINE_BOOL(incremental_marking_task, true, "use tasks for incremental marking")
+DEFINE_FLOAT(incremental_marking_pause_target, 0,
+             "target for the atomic pause of incremental marking in ms; "
+             "marking is scheduled to finish within this pause (0 disables)")
 DEFINE_INT(incremental_marking_soft_trigger, 0,
            "threshold for starting incremental marking via a task in percent "
            "of available space: limit - size")
@@ -1339,6 +1384,9 @@ DEFINE_BOOL(memory_reducer_for_small_heaps, true,
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(huge_page_pool, false,
+            "back regular data pages with 2MB regions that use transparent "
+            "huge pages where available")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
@@ -1760,6 +1808,11 @@ DEFINE_BOOL(experimental_flush_embedded_blob_icache, true,
 DEFINE_BOOL(short_builtin_calls, V8_SHORT_BUILTIN_CALLS_BOOL,
             "Put embedded builtins code into the code range for shorter "
             "builtin calls/jumps if system has >=4GB memory")
+DEFINE_INT(shared_ptr_compr_cages, 1,
+           "number of pointer compression cages that isolates are distributed "
+           "over in builds with a shared cage (at most 16); while a shared "
+           "isolate exists, all new isolates are placed into its cage so that "
+           "they can attach to it as clients")
 
 // runtime.cc
 DEFINE_BOOL(runtime_call_stats, false, "report runtime call counts and times")
@@ -1782,6 +1835,10 @@ DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+DEFINE_BOOL(snapshot_tiering_hints, false,
+            "record in snapshots created with kept function code which "
+            "functions got hot, and optimize them after the first tick in "
+            "isolates deserialized from the snapshot")
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
@@ -1877,6 +1934,9 @@ DEFINE_NEG_NEG_IMPLICATION(text_is_readable, partial_constant_pool)
 DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
             "trace parallel marking for the young generation")
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
+DEFINE_BOOL(minor_mc_sweep_promoted_pages, true,
+            "rebuild the free lists of pages promoted by the minor "
+            "mark-compactor in parallel with evacuation")
 #else
 DEFINE_BOOL_READONLY(minor_mc, false,
                      "perform young generation mark compact GCs")
@@ -4,11 +4,14 @@
 
 #include "src/heap/code-range.h"
 
+#include <array>
+
 #include "src/base/bits.h"
 #include "src/base/lazy-instance.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/heap/heap-inl.h"
+#include "src/init/isolate-allocator.h"
 #include "src/utils/allocation.h"
 
 namespace v8 {
@@ -20,11 +23,27 @@ namespace {
 base::LazyMutex process_wide_code_range_creation_mutex_ =
     LAZY_MUTEX_INITIALIZER;
 
-// Weak pointer holding the process-wide CodeRange, if one has been created. All
-// Heaps hold a std::shared_ptr to this, so this is destroyed when no Heaps
-// remain.
-base::LazyInstance<std::weak_ptr<CodeRange>>::type process_wide_code_range_ =
-    LAZY_INSTANCE_INITIALIZER;
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+constexpr int kProcessWideCodeRangeCount = kMaxSharedPtrComprCages;
+#else
+constexpr int kProcessWideCodeRangeCount = 1;
+#endif
+
+// Weak pointers holding the process-wide CodeRange of each shared pointer
+// compression cage, if one has been created. All Heaps in a cage hold a
+// std::shared_ptr to it, so it is destroyed when no Heaps remain.
+base::LazyInstance<std::array<std::weak_ptr<CodeRange>,
+                              kProcessWideCodeRangeCount>>::type
+    process_wide_code_ranges_ = LAZY_INSTANCE_INITIALIZER;
+
+// Returns -1 if |cage_base| does not belong to a shared cage.
+int ProcessWideCodeRangeIndex(Address cage_base) {
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  return IsolateAllocator::GetSharedPtrComprCageIndex(cage_base);
+#else
+  return 0;
+#endif
+}
 
 DEFINE_LAZY_LEAKY_OBJECT_GETTER(CodeRangeAddressHint, GetCodeRangeAddressHint)
 
@@ -227,23 +246,31 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
 
 // static
 std::shared_ptr<CodeRange> CodeRange::EnsureProcessWideCodeRange(
-    v8::PageAllocator* page_allocator, size_t requested_size) {
+    Address cage_base, v8::PageAllocator* page_allocator,
+    size_t requested_size) {
+  const int index = ProcessWideCodeRangeIndex(cage_base);
+  CHECK_LE(0, index);
   base::MutexGuard guard(process_wide_code_range_creation_mutex_.Pointer());
-  std::shared_ptr<CodeRange> code_range = process_wide_code_range_.Get().lock();
+  std::weak_ptr<CodeRange>& process_wide_code_range =
+      (*process_wide_code_ranges_.Pointer())[index];
+  std::shared_ptr<CodeRange> code_range = process_wide_code_range.lock();
   if (!code_range) {
     code_range = std::make_shared<CodeRange>();
     if (!code_range->InitReservation(page_allocator, requested_size)) {
       V8::FatalProcessOutOfMemory(
           nullptr, "Failed to reserve virtual memory for CodeRange");
     }
-    *process_wide_code_range_.Pointer() = code_range;
+    process_wide_code_range = code_range;
   }
   return code_range;
 }
 
 // static
-std::shared_ptr<CodeRange> CodeRange::GetProcessWideCodeRange() {
-  return process_wide_code_range_.Get().lock();
+std::shared_ptr<CodeRange> CodeRange::GetProcessWideCodeRange(
+    Address cage_base) {
+  const int index = ProcessWideCodeRangeIndex(cage_base);
+  if (index < 0) return {};
+  return process_wide_code_ranges_.Get()[index].lock();
 }
 
 }  // namespace internal
@@ -129,12 +129,16 @@ class CodeRange final : public VirtualMemoryCage {
                                  const uint8_t* embedded_blob_code,
                                  size_t embedded_blob_code_size);
 
+  // There is one process-wide CodeRange per shared pointer compression cage.
   static std::shared_ptr<CodeRange> EnsureProcessWideCodeRange(
-      v8::PageAllocator* page_allocator, size_t requested_size);
-
-  // If InitializeProcessWideCodeRangeOnce has been called, returns the
-  // initialized CodeRange. Otherwise returns an empty std::shared_ptr.
-  V8_EXPORT_PRIVATE static std::shared_ptr<CodeRange> GetProcessWideCodeRange();
+      Address cage_base, v8::PageAllocator* page_allocator,
+      size_t requested_size);
+
+  // If EnsureProcessWideCodeRange has been called for the cage with the given
+  // base, returns the initialized CodeRange. Otherwise returns an empty
+  // std::shared_ptr.
+  V8_EXPORT_PRIVATE static std::shared_ptr<CodeRange> GetProcessWideCodeRange(
+      Address cage_base);
 
  private:
   // Used when short builtin calls are enabled, where embedded builtins are
@@ -613,6 +613,12 @@ void ConcurrentMarking::RescheduleJobIfNeeded(TaskPriority priority) {
   }
 }
 
+void ConcurrentMarking::UpdateJobPriority(TaskPriority priority) {
+  DCHECK(FLAG_parallel_marking || FLAG_concurrent_marking);
+  if (!job_handle_ || !job_handle_->IsValid()) return;
+  job_handle_->UpdatePriority(priority);
+}
+
 void ConcurrentMarking::Join() {
   DCHECK(FLAG_parallel_marking || FLAG_concurrent_marking);
   if (!job_handle_ || !job_handle_->IsValid()) return;
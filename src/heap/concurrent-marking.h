@@ -77,6 +77,8 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
   // and the priority if diffrent from the default kUserVisible.
   void RescheduleJobIfNeeded(
       TaskPriority priority = TaskPriority::kUserVisible);
+  // Changes the priority of the job if one is scheduled.
+  void UpdateJobPriority(TaskPriority priority);
   // Flushes native context sizes to the given table of the main thread.
   void FlushNativeContexts(NativeContextStats* main_stats);
   // Flushes memory chunk data using the given marking state.
@@ -216,7 +216,9 @@ UnifiedHeapMarker::UnifiedHeapMarker(Heap* v8_heap,
                                      cppgc::Platform* platform,
                                      MarkingConfig config)
     : cppgc::internal::MarkerBase(heap, platform, config),
-      unified_heap_marking_state_(v8_heap),
+      unified_heap_marking_state_(
+          v8_heap, config.collection_type ==
+                       MarkingConfig::CollectionType::kMinor),
       marking_visitor_(heap, mutator_marking_state_,
                        unified_heap_marking_state_),
       conservative_marking_visitor_(heap, mutator_marking_state_,
@@ -428,7 +430,8 @@ bool ShouldReduceMemory(CppHeap::GarbageCollectionFlags flags) {
 
 }  // namespace
 
-void CppHeap::InitializeTracing(GarbageCollectionFlags gc_flags) {
+void CppHeap::InitializeTracing(CollectionType collection_type,
+                                GarbageCollectionFlags gc_flags) {
   CHECK(!sweeper_.IsSweepingInProgress());
 
   // Check that previous cycle metrics have been reported.
@@ -436,15 +439,22 @@ void CppHeap::InitializeTracing(GarbageCollectionFlags gc_flags) {
                  !GetMetricRecorder()->MetricsReportPending());
 
 #if defined(CPPGC_YOUNG_GENERATION)
-  cppgc::internal::SequentialUnmarker unmarker(raw_heap());
+  if (collection_type == CollectionType::kMajor) {
+    // The unmarker clears all mark bits when it is constructed.
+    cppgc::internal::SequentialUnmarker unmarker(raw_heap());
+  }
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 
+  current_collection_type_ = collection_type;
   current_gc_flags_ = gc_flags;
 
+  // Minor garbage collections are always atomic as they are part of a
+  // scavenge.
   const UnifiedHeapMarker::MarkingConfig marking_config{
-      UnifiedHeapMarker::MarkingConfig::CollectionType::kMajor,
-      cppgc::Heap::StackState::kNoHeapPointers,
-      (IsForceGC(current_gc_flags_) && !force_incremental_marking_for_testing_)
+      collection_type, cppgc::Heap::StackState::kNoHeapPointers,
+      (collection_type == CollectionType::kMinor ||
+       (IsForceGC(current_gc_flags_) &&
+        !force_incremental_marking_for_testing_))
           ? UnifiedHeapMarker::MarkingConfig::MarkingType::kAtomic
           : UnifiedHeapMarker::MarkingConfig::MarkingType::
                 kIncrementalAndConcurrent,
@@ -454,7 +464,8 @@ void CppHeap::InitializeTracing(GarbageCollectionFlags gc_flags) {
   DCHECK_IMPLIES(!isolate_, (cppgc::Heap::MarkingType::kAtomic ==
                              marking_config.marking_type) ||
                                 force_incremental_marking_for_testing_);
-  if (ShouldReduceMemory(current_gc_flags_)) {
+  if (collection_type == CollectionType::kMajor &&
+      ShouldReduceMemory(current_gc_flags_)) {
     // Only enable compaction when in a memory reduction garbage collection as
     // it may significantly increase the final garbage collection pause.
     compactor_.InitializeIfShouldCompact(marking_config.marking_type,
@@ -523,16 +534,17 @@ void CppHeap::TraceEpilogue() {
   buffered_allocated_bytes_ = 0;
   const size_t bytes_allocated_in_prefinalizers = ExecutePreFinalizers();
 #if CPPGC_VERIFY_HEAP
-  UnifiedHeapMarkingVerifier verifier(
-      *this, cppgc::internal::Heap::Config::CollectionType::kMajor);
-  verifier.Run(
-      stack_state_of_prev_gc(), stack_end_of_current_gc(),
-      stats_collector()->marked_bytes() + bytes_allocated_in_prefinalizers);
+  UnifiedHeapMarkingVerifier verifier(*this, current_collection_type_);
+  verifier.Run(stack_state_of_prev_gc(), stack_end_of_current_gc(),
+               stats_collector()->marked_bytes_on_current_cycle() +
+                   bytes_allocated_in_prefinalizers);
 #endif  // CPPGC_VERIFY_HEAP
   USE(bytes_allocated_in_prefinalizers);
 
 #if defined(CPPGC_YOUNG_GENERATION)
   ResetRememberedSet();
+  // All C++ objects that survived this cycle are old now.
+  cross_heap_remembered_set_.clear();
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 
   {
@@ -561,6 +573,57 @@ void CppHeap::TraceEpilogue() {
   sweeper().NotifyDoneIfNeeded();
 }
 
+void CppHeap::CollectYoungGeneration(
+    const std::vector<void*>& young_wrappables,
+    const std::vector<void*>& promoted_wrappables) {
+#if defined(CPPGC_YOUNG_GENERATION)
+  DCHECK(FLAG_cppgc_young_generation);
+  DCHECK_NOT_NULL(isolate_);
+  // Wrappers promoted by the scavenge are old from now on. Remember their C++
+  // objects in case they stay young because this collection is skipped.
+  for (void* wrappable : promoted_wrappables) {
+    RememberCrossHeapReferenceIfNeeded(wrappable);
+  }
+
+  // A minor collection requires the mark bits of the last cycle, i.e., no
+  // major marking and no sweeping may be in progress.
+  if (IsMarking() || sweeper().IsSweepingInProgress() || in_no_gc_scope() ||
+      in_disallow_gc_scope()) {
+    return;
+  }
+
+  SetStackEndOfCurrentGC(v8::base::Stack::GetCurrentStackPosition());
+  InitializeTracing(CollectionType::kMinor,
+                    GarbageCollectionFlagValues::kNoFlags);
+  StartTracing();
+  UnifiedHeapMarker& marker = *static_cast<UnifiedHeapMarker*>(marker_.get());
+  for (void* wrappable : young_wrappables) marker.AddObject(wrappable);
+  for (void* wrappable : cross_heap_remembered_set_) {
+    marker.AddObject(wrappable);
+  }
+  EnterFinalPause(
+      isolate_->heap()->local_embedder_heap_tracer()->embedder_stack_state());
+  AdvanceTracing(std::numeric_limits<double>::infinity());
+  TraceEpilogue();
+#else   // !defined(CPPGC_YOUNG_GENERATION)
+  USE(young_wrappables);
+  USE(promoted_wrappables);
+  UNREACHABLE();
+#endif  // !defined(CPPGC_YOUNG_GENERATION)
+}
+
+void CppHeap::RememberCrossHeapReferenceIfNeeded(void* wrappable) {
+#if defined(CPPGC_YOUNG_GENERATION)
+  DCHECK(FLAG_cppgc_young_generation);
+  if (!cppgc::internal::HeapObjectHeader::FromObject(wrappable).IsYoung())
+    return;
+  cross_heap_remembered_set_.insert(wrappable);
+#else   // !defined(CPPGC_YOUNG_GENERATION)
+  USE(wrappable);
+  UNREACHABLE();
+#endif  // !defined(CPPGC_YOUNG_GENERATION)
+}
+
 void CppHeap::AllocatedObjectSizeIncreased(size_t bytes) {
   buffered_allocated_bytes_ += static_cast<int64_t>(bytes);
   ReportBufferedAllocationSizeIfPossible();
@@ -612,7 +675,8 @@ void CppHeap::CollectGarbageForTesting(
     // Perform an atomic GC, with starting incremental/concurrent marking and
     // immediately finalizing the garbage collection.
     if (!IsMarking()) {
-      InitializeTracing(GarbageCollectionFlagValues::kForced);
+      InitializeTracing(CollectionType::kMajor,
+                        GarbageCollectionFlagValues::kForced);
       StartTracing();
     }
     EnterFinalPause(stack_state);
@@ -635,7 +699,8 @@ void CppHeap::StartIncrementalGarbageCollectionForTesting() {
   DCHECK_NULL(isolate_);
   if (IsMarking()) return;
   force_incremental_marking_for_testing_ = true;
-  InitializeTracing(GarbageCollectionFlagValues::kForced);
+  InitializeTracing(CollectionType::kMajor,
+                    GarbageCollectionFlagValues::kForced);
   StartTracing();
   force_incremental_marking_for_testing_ = false;
 }
@@ -10,6 +10,9 @@ static_assert(
     false, "V8 targets can not be built with cppgc_is_standalone set to true.");
 #endif
 
+#include <unordered_set>
+#include <vector>
+
 #include "include/v8-callbacks.h"
 #include "include/v8-cppgc.h"
 #include "include/v8-metrics.h"
@@ -40,6 +43,8 @@ class V8_EXPORT_PRIVATE CppHeap final
   };
 
   using GarbageCollectionFlags = base::Flags<GarbageCollectionFlagValues>;
+  using CollectionType =
+      cppgc::internal::GarbageCollector::Config::CollectionType;
 
   class MetricRecorderAdapter final : public cppgc::internal::MetricRecorder {
    public:
@@ -117,13 +122,23 @@ class V8_EXPORT_PRIVATE CppHeap final
 
   void FinishSweepingIfRunning();
 
-  void InitializeTracing(GarbageCollectionFlags);
+  void InitializeTracing(CollectionType, GarbageCollectionFlags);
   void StartTracing();
   bool AdvanceTracing(double max_duration);
   bool IsTracingDone();
   void TraceEpilogue();
   void EnterFinalPause(cppgc::EmbedderStackState stack_state);
 
+  // Runs an atomic minor garbage collection right after a scavenge. Requires
+  // --cppgc-young-generation. {young_wrappables} and {promoted_wrappables} are
+  // the C++ objects held by JS wrappers that survived the scavenge in the young
+  // generation and that were promoted by it, respectively.
+  void CollectYoungGeneration(const std::vector<void*>& young_wrappables,
+                              const std::vector<void*>& promoted_wrappables);
+  // Records {wrappable} as root for minor garbage collections if it is young.
+  // Used for references from old JS wrappers.
+  void RememberCrossHeapReferenceIfNeeded(void* wrappable);
+
   // StatsCollector::AllocationObserver interface.
   void AllocatedObjectSizeIncreased(size_t) final;
   void AllocatedObjectSizeDecreased(size_t) final;
@@ -156,6 +171,7 @@ class V8_EXPORT_PRIVATE CppHeap final
   Isolate* isolate_ = nullptr;
   bool marking_done_ = false;
   GarbageCollectionFlags current_gc_flags_;
+  CollectionType current_collection_type_ = CollectionType::kMajor;
 
   // Buffered allocated bytes. Reporting allocated bytes to V8 can trigger a GC
   // atomic pause. Allocated bytes are buffer in case this is temporarily
@@ -164,6 +180,11 @@ class V8_EXPORT_PRIVATE CppHeap final
 
   v8::WrapperDescriptor wrapper_descriptor_;
 
+#if defined(CPPGC_YOUNG_GENERATION)
+  // Young C++ objects referenced from old JS wrappers.
+  std::unordered_set<void*> cross_heap_remembered_set_;
+#endif  // defined(CPPGC_YOUNG_GENERATION)
+
   bool in_detached_testing_mode_ = false;
   bool force_incremental_marking_for_testing_ = false;
 
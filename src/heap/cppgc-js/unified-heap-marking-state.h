@@ -22,7 +22,8 @@ class BasicTracedReferenceExtractor {
 
 class UnifiedHeapMarkingState {
  public:
-  explicit UnifiedHeapMarkingState(Heap* heap) : heap_(heap) {}
+  UnifiedHeapMarkingState(Heap* heap, bool is_minor_gc)
+      : heap_(heap), is_minor_gc_(is_minor_gc) {}
 
   UnifiedHeapMarkingState(const UnifiedHeapMarkingState&) = delete;
   UnifiedHeapMarkingState& operator=(const UnifiedHeapMarkingState&) = delete;
@@ -31,9 +32,14 @@ class UnifiedHeapMarkingState {
 
  private:
   Heap* heap_;
+  const bool is_minor_gc_;
 };
 
 void UnifiedHeapMarkingState::MarkAndPush(const TracedReferenceBase& ref) {
+  // Minor garbage collections run right after a scavenge, which already kept
+  // young V8 objects reachable from TracedReference alive. Old V8 objects are
+  // not collected.
+  if (is_minor_gc_) return;
   // The same visitor is used in testing scenarios without attaching the heap to
   // an Isolate under the assumption that no non-empty v8 references are found.
   // Having the following DCHECK crash means that the heap is in detached mode
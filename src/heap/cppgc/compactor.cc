@@ -4,12 +4,16 @@
 
 #include "src/heap/cppgc/compactor.h"
 
-#include <map>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
 #include <numeric>
+#include <set>
 #include <unordered_map>
-#include <unordered_set>
 
 #include "include/cppgc/macros.h"
+#include "include/cppgc/platform.h"
 #include "src/heap/cppgc/compaction-worklists.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/heap-base.h"
@@ -27,11 +31,31 @@ namespace {
 // Freelist size threshold that must be exceeded before compaction
 // should be considered.
 static constexpr size_t kFreeListSizeThreshold = 512 * kKB;
+// A compactable space is only evacuated if at least this fraction of its
+// pages is sitting in the free list. Evacuating dense spaces costs pause time
+// without returning memory.
+static constexpr double kMinFragmentationRatio = 0.25;
+// Number of slots that are updated by a single parallel work item.
+static constexpr size_t kSlotsPerWorkItem = 1024;
+
+// Evacuation state of a single space. Spaces are evacuated independently and
+// in parallel.
+struct EvacuatedSpace {
+  explicit EvacuatedSpace(NormalPageSpace* space) : space(space) {}
+
+  NormalPageSpace* space;
+  // Map from the old to the new payload address of moved objects.
+  std::unordered_map<Address, Address> forwarding_addresses;
+  // Pages that became empty during evacuation. They are released on the
+  // mutator thread after evacuation.
+  std::vector<NormalPage*> released_pages;
+};
 
 // The real worker behind heap compaction, recording references to movable
-// objects ("slots".) When the objects end up being compacted and moved,
-// relocate() will adjust the slots to point to the new location of the
-// object along with handling references for interior pointers.
+// objects ("slots".) Compaction evacuates objects first and records their
+// forwarding addresses. UpdateSlots() then adjusts the slots to point to the
+// new location of the objects, taking into account that the slots themselves
+// may have been moved.
 //
 // The MovableReferences object is created and maintained for the lifetime
 // of one heap compaction-enhanced GC.
@@ -39,44 +63,63 @@ class MovableReferences final {
   using MovableReference = CompactionWorklists::MovableReference;
 
  public:
-  explicit MovableReferences(HeapBase& heap) : heap_(heap) {}
+  MovableReferences(HeapBase& heap,
+                    const std::vector<NormalPageSpace*>& compacted_spaces)
+      : heap_(heap), compacted_spaces_(compacted_spaces) {}
 
   // Adds a slot for compaction. Filters slots in dead objects.
   void AddOrFilter(MovableReference*);
 
-  // Relocates a backing store |from| -> |to|.
-  void Relocate(Address from, Address to);
+  // Fixes up slots in a backing store that is moved |from| -> |to| which point
+  // into the backing store itself. Such interior pointers do not refer to an
+  // object start and thus have no forwarding address. Safe to call
+  // concurrently for different backing stores.
+  void RelocateInteriorReferences(Address from, Address to, size_t size) const;
+
+  // Adds the forwarding addresses of an evacuated space. Must be called for
+  // all spaces before updating slots.
+  void AddForwardingAddresses(const EvacuatedSpace&);
 
-  // Relocates interior slots in a backing store that is moved |from| -> |to|.
-  void RelocateInteriorReferences(Address from, Address to, size_t size);
+  size_t NumberOfSlotWorkItems() const {
+    return (slots_.size() + kSlotsPerWorkItem - 1) / kSlotsPerWorkItem;
+  }
 
-  // Updates the collection of callbacks from the item pushed the worklist by
-  // marking visitors.
-  void UpdateCallbacks();
+  // Updates the slots of work item |item| to the forwarding addresses of the
+  // objects they refer to. Safe to call concurrently for different items.
+  void UpdateSlots(size_t item) const;
 
  private:
+  struct Slot {
+    MovableReference* slot;
+    MovableReference value;
+    // Payload of the object containing |slot| if it resides on a compacted
+    // space, or nullptr otherwise.
+    Address slot_object;
+  };
+
+  bool IsCompactedSpace(const BaseSpace& space) const {
+    return std::find(compacted_spaces_.begin(), compacted_spaces_.end(),
+                     &space) != compacted_spaces_.end();
+  }
+
+  void UpdateSlot(const Slot&) const;
+
   HeapBase& heap_;
+  const std::vector<NormalPageSpace*>& compacted_spaces_;
 
-  // Map from movable reference (value) to its slot. Upon moving an object its
-  // slot pointing to it requires updating. Movable reference should currently
-  // have only a single movable reference to them registered.
+  // Map from movable reference (value) to its slot. Movable reference should
+  // currently have only a single movable reference to them registered.
   std::unordered_map<MovableReference, MovableReference*> movable_references_;
 
-  // Map of interior slots to their final location. Needs to be an ordered map
-  // as it is used to walk through slots starting at a given memory address.
-  // Requires log(n) lookup to make the early bailout reasonably fast.
-  //
-  // - The initial value for a given key is nullptr.
-  // - Upon moving an object this value is adjusted accordingly.
-  std::map<MovableReference*, Address> interior_movable_references_;
-
-#if DEBUG
-  // The following two collections are used to allow refer back from a slot to
-  // an already moved object.
-  std::unordered_set<const void*> moved_objects_;
-  std::unordered_map<MovableReference*, MovableReference>
-      interior_slot_to_object_;
-#endif  // DEBUG
+  // All recorded slots, processed in chunks of kSlotsPerWorkItem.
+  std::vector<Slot> slots_;
+
+  // Slots residing on compacted spaces. Needs to be an ordered set as it is
+  // used to walk through slots starting at a given memory address.
+  std::set<MovableReference*> interior_movable_references_;
+
+  // Map from the old to the new payload address of all moved objects.
+  std::unordered_map<Address, Address> forwarding_addresses_;
 };
 
 void MovableReferences::AddOrFilter(MovableReference* slot) {
@@ -102,8 +145,8 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
 
   // The following cases are not compacted and do not require recording:
   // - Compactable object on large pages.
-  // - Compactable object on non-compactable spaces.
-  if (value_page->is_large() || !value_page->space().is_compactable()) return;
+  // - Compactable object on spaces that are not compacted in this cycle.
+  if (value_page->is_large() || !IsCompactedSpace(value_page->space())) return;
 
   // Slots must reside in and values must point to live objects at this
   // point. |value| usually points to a separate object but can also point
@@ -124,107 +167,93 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
   movable_references_.emplace(value, slot);
 
   // Check whether the slot itself resides on a page that is compacted.
-  if (V8_LIKELY(!slot_page->space().is_compactable())) return;
-
-  CHECK_EQ(interior_movable_references_.end(),
-           interior_movable_references_.find(slot));
-  interior_movable_references_.emplace(slot, nullptr);
-#if DEBUG
-  interior_slot_to_object_.emplace(slot, slot_header.ObjectStart());
-#endif  // DEBUG
-}
-
-void MovableReferences::Relocate(Address from, Address to) {
-#if DEBUG
-  moved_objects_.insert(from);
-#endif  // DEBUG
-
-  // Interior slots always need to be processed for moved objects.
-  // Consider an object A with slot A.x pointing to value B where A is
-  // allocated on a movable page itself. When B is finally moved, it needs to
-  // find the corresponding slot A.x. Object A may be moved already and the
-  // memory may have been freed, which would result in a crash.
-  if (!interior_movable_references_.empty()) {
-    const HeapObjectHeader& header = HeapObjectHeader::FromObject(to);
-    const size_t size = header.ObjectSize();
-    RelocateInteriorReferences(from, to, size);
-  }
-
-  auto it = movable_references_.find(from);
-  // This means that there is no corresponding slot for a live object.
-  // This may happen because a mutator may change the slot to point to a
-  // different object because e.g. incremental marking marked an object
-  // as live that was later on replaced.
-  if (it == movable_references_.end()) {
+  if (V8_LIKELY(!IsCompactedSpace(slot_page->space()))) {
+    slots_.push_back({slot, value, nullptr});
     return;
   }
 
-  // If the object is referenced by a slot that is contained on a compacted
-  // area itself, check whether it can be updated already.
-  MovableReference* slot = it->second;
-  auto interior_it = interior_movable_references_.find(slot);
-  if (interior_it != interior_movable_references_.end()) {
-    MovableReference* slot_location =
-        reinterpret_cast<MovableReference*>(interior_it->second);
-    if (!slot_location) {
-      interior_it->second = to;
-#if DEBUG
-      // Check that the containing object has not been moved yet.
-      auto reverse_it = interior_slot_to_object_.find(slot);
-      DCHECK_NE(interior_slot_to_object_.end(), reverse_it);
-      DCHECK_EQ(moved_objects_.end(), moved_objects_.find(reverse_it->second));
-#endif  // DEBUG
-    } else {
-      slot = slot_location;
-    }
-  }
-
-  // Compaction is atomic so slot should not be updated during compaction.
-  DCHECK_EQ(from, *slot);
-
-  // Update the slots new value.
-  *slot = to;
+  CHECK_EQ(interior_movable_references_.end(),
+           interior_movable_references_.find(slot));
+  interior_movable_references_.insert(slot);
+  slots_.push_back({slot, value, slot_header.ObjectStart()});
 }
 
 void MovableReferences::RelocateInteriorReferences(Address from, Address to,
-                                                   size_t size) {
+                                                   size_t size) const {
+  if (interior_movable_references_.empty()) return;
+
   // |from| is a valid address for a slot.
   auto interior_it = interior_movable_references_.lower_bound(
       reinterpret_cast<MovableReference*>(from));
   if (interior_it == interior_movable_references_.end()) return;
-  DCHECK_GE(reinterpret_cast<Address>(interior_it->first), from);
+  DCHECK_GE(reinterpret_cast<Address>(*interior_it), from);
 
-  size_t offset = reinterpret_cast<Address>(interior_it->first) - from;
+  size_t offset = reinterpret_cast<Address>(*interior_it) - from;
   while (offset < size) {
-    if (!interior_it->second) {
-      // Update the interior reference value, so that when the object the slot
-      // is pointing to is moved, it can re-use this value.
-      Address refernece = to + offset;
-      interior_it->second = refernece;
-
-      // If the |slot|'s content is pointing into the region [from, from +
-      // size) we are dealing with an interior pointer that does not point to
-      // a valid HeapObjectHeader. Such references need to be fixed up
-      // immediately.
-      Address& reference_contents = *reinterpret_cast<Address*>(refernece);
-      if (reference_contents > from && reference_contents < (from + size)) {
-        reference_contents = reference_contents - from + to;
-      }
+    // If the slot's content is pointing into the region [from, from + size)
+    // we are dealing with an interior pointer that does not point to a valid
+    // HeapObjectHeader. Such references need to be fixed up immediately.
+    Address& reference_contents = *reinterpret_cast<Address*>(to + offset);
+    if (reference_contents > from && reference_contents < (from + size)) {
+      reference_contents = reference_contents - from + to;
     }
 
     interior_it++;
     if (interior_it == interior_movable_references_.end()) return;
-    offset = reinterpret_cast<Address>(interior_it->first) - from;
+    offset = reinterpret_cast<Address>(*interior_it) - from;
   }
 }
 
+void MovableReferences::AddForwardingAddresses(
+    const EvacuatedSpace& evacuated_space) {
+  forwarding_addresses_.insert(evacuated_space.forwarding_addresses.begin(),
+                               evacuated_space.forwarding_addresses.end());
+}
+
+void MovableReferences::UpdateSlots(size_t item) const {
+  const size_t start = item * kSlotsPerWorkItem;
+  const size_t end = std::min(start + kSlotsPerWorkItem, slots_.size());
+  for (size_t i = start; i < end; ++i) {
+    UpdateSlot(slots_[i]);
+  }
+}
+
+void MovableReferences::UpdateSlot(const Slot& slot) const {
+  // The value may not have been moved, e.g., because it was already at the
+  // compaction frontier. The slot can be left as is in this case.
+  auto value_it = forwarding_addresses_.find(
+      const_cast<Address>(static_cast<ConstAddress>(slot.value)));
+  if (value_it == forwarding_addresses_.end()) return;
+
+  // If the slot is contained in an object that was moved, it has to be
+  // updated at the new location of the object.
+  MovableReference* slot_location = slot.slot;
+  if (slot.slot_object) {
+    auto slot_object_it = forwarding_addresses_.find(slot.slot_object);
+    if (slot_object_it != forwarding_addresses_.end()) {
+      slot_location = reinterpret_cast<MovableReference*>(
+          slot_object_it->second +
+          (reinterpret_cast<Address>(slot.slot) - slot.slot_object));
+    }
+  }
+
+  // Compaction is atomic so slot should not be updated during compaction.
+  DCHECK_EQ(slot.value, *slot_location);
+
+  // Update the slots new value.
+  *slot_location = value_it->second;
+}
+
 class CompactionState final {
   CPPGC_STACK_ALLOCATED();
   using Pages = std::vector<NormalPage*>;
 
  public:
-  CompactionState(NormalPageSpace* space, MovableReferences& movable_references)
-      : space_(space), movable_references_(movable_references) {}
+  CompactionState(EvacuatedSpace& evacuated_space,
+                  const MovableReferences& movable_references)
+      : space_(evacuated_space.space),
+        evacuated_space_(evacuated_space),
+        movable_references_(movable_references) {}
 
   void AddPage(NormalPage* page) {
     DCHECK_EQ(space_, &page->space());
@@ -256,8 +285,11 @@ class CompactionState final {
         memmove(compact_frontier, header, size);
       else
         memcpy(compact_frontier, header, size);
-      movable_references_.Relocate(header + sizeof(HeapObjectHeader),
-                                   compact_frontier + sizeof(HeapObjectHeader));
+      const Address from = header + sizeof(HeapObjectHeader);
+      const Address to = compact_frontier + sizeof(HeapObjectHeader);
+      movable_references_.RelocateInteriorReferences(
+          from, to, size - sizeof(HeapObjectHeader));
+      evacuated_space_.forwarding_addresses.emplace(from, to);
     }
     current_page_->object_start_bitmap().SetBit(compact_frontier);
     used_bytes_in_current_page_ += size;
@@ -273,11 +305,11 @@ class CompactionState final {
       ReturnCurrentPageToSpace();
     }
 
-    // Return remaining available pages to the free page pool, decommitting
-    // them from the pagefile.
+    // Remaining available pages are returned to the free page pool on the
+    // mutator thread, decommitting them from the pagefile.
     for (NormalPage* page : available_pages_) {
       SetMemoryInaccessible(page->PayloadStart(), page->PayloadSize());
-      NormalPage::Destroy(page);
+      evacuated_space_.released_pages.push_back(page);
     }
   }
 
@@ -311,7 +343,8 @@ class CompactionState final {
   }
 
   NormalPageSpace* space_;
-  MovableReferences& movable_references_;
+  EvacuatedSpace& evacuated_space_;
+  const MovableReferences& movable_references_;
   // Page into which compacted object will be written to.
   NormalPage* current_page_ = nullptr;
   // Offset into |current_page_| to the next free address.
@@ -342,11 +375,7 @@ void CompactPage(NormalPage* page, CompactionState& compaction_state) {
     }
 
     if (!header->IsMarked()) {
-      // Compaction is currently launched only from AtomicPhaseEpilogue, so it's
-      // guaranteed to be on the mutator thread - no need to postpone
-      // finalization.
-      header->Finalize();
-
+      // The object has already been finalized by FinalizeUnmarkedObjects().
       // As compaction is under way, leave the freed memory accessible
       // while compacting the rest of the page. We just zap the payload
       // to catch out other finalizers trying to access it.
@@ -372,9 +401,26 @@ void CompactPage(NormalPage* page, CompactionState& compaction_state) {
   compaction_state.FinishCompactingPage(page);
 }
 
-void CompactSpace(NormalPageSpace* space,
-                  MovableReferences& movable_references) {
+// Finalizers may only run on the mutator thread. Dead objects on compacted
+// spaces are thus finalized before evacuation which may run in parallel.
+void FinalizeUnmarkedObjects(NormalPageSpace* space) {
+  for (BasePage* page : *space) {
+    NormalPage* normal_page = NormalPage::From(page);
+    for (Address header_address = normal_page->PayloadStart();
+         header_address < normal_page->PayloadEnd();) {
+      HeapObjectHeader* header =
+          reinterpret_cast<HeapObjectHeader*>(header_address);
+      const size_t size = header->AllocatedSize();
+      if (!header->IsFree() && !header->IsMarked()) header->Finalize();
+      header_address += size;
+    }
+  }
+}
+
+void CompactSpace(EvacuatedSpace& evacuated_space,
+                  const MovableReferences& movable_references) {
   using Pages = NormalPageSpace::Pages;
+  NormalPageSpace* space = evacuated_space.space;
 
 #ifdef V8_USE_ADDRESS_SANITIZER
   UnmarkedObjectsPoisoner().Traverse(*space);
@@ -413,7 +459,7 @@ void CompactSpace(NormalPageSpace* space,
   Pages pages = space->RemoveAllPages();
   if (pages.empty()) return;
 
-  CompactionState compaction_state(space, movable_references);
+  CompactionState compaction_state(evacuated_space, movable_references);
   for (BasePage* page : pages) {
     // Large objects do not belong to this arena.
     CompactPage(NormalPage::From(page), compaction_state);
@@ -423,6 +469,13 @@ void CompactSpace(NormalPageSpace* space,
   // Sweeping will verify object start bitmap of compacted space.
 }
 
+bool IsFragmented(const NormalPageSpace* space) {
+  DCHECK(space->is_compactable());
+  if (!space->size()) return false;
+  return space->free_list().Size() >=
+         kMinFragmentationRatio * space->size() * NormalPage::PayloadSize();
+}
+
 size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
   return std::accumulate(spaces.cbegin(), spaces.cend(), 0u,
                          [](size_t acc, const NormalPageSpace* space) {
@@ -432,6 +485,64 @@ size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
                          });
 }
 
+// Processes work items [0, num_items) by invoking |callback| for each of them.
+// Items are processed in parallel if the platform supports jobs. The mutator
+// thread always contributes and blocks until all items are processed.
+class ParallelCompactionJob final {
+ public:
+  using Callback = std::function<void(size_t)>;
+
+  static void Run(Platform* platform, size_t num_items, Callback callback) {
+    if (!num_items) return;
+    ParallelCompactionJob job(num_items, std::move(callback));
+    std::unique_ptr<JobHandle> handle;
+    if (platform && num_items > 1) {
+      handle = platform->PostJob(TaskPriority::kUserBlocking,
+                                 std::make_unique<Task>(job));
+    }
+    if (handle) {
+      handle->Join();
+    } else {
+      job.ProcessItems(nullptr);
+    }
+    DCHECK_EQ(num_items, job.processed_items_.load(std::memory_order_relaxed));
+  }
+
+ private:
+  class Task final : public JobTask {
+   public:
+    explicit Task(ParallelCompactionJob& job) : job_(job) {}
+
+    void Run(JobDelegate* delegate) final { job_.ProcessItems(delegate); }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const final {
+      const size_t next_item = job_.next_item_.load(std::memory_order_relaxed);
+      return next_item < job_.num_items_ ? job_.num_items_ - next_item : 0;
+    }
+
+   private:
+    ParallelCompactionJob& job_;
+  };
+
+  ParallelCompactionJob(size_t num_items, Callback callback)
+      : num_items_(num_items), callback_(std::move(callback)) {}
+
+  void ProcessItems(JobDelegate* delegate) {
+    while (true) {
+      const size_t item = next_item_.fetch_add(1, std::memory_order_relaxed);
+      if (item >= num_items_) return;
+      callback_(item);
+      processed_items_.fetch_add(1, std::memory_order_relaxed);
+      if (delegate && delegate->ShouldYield()) return;
+    }
+  }
+
+  const size_t num_items_;
+  const Callback callback_;
+  std::atomic<size_t> next_item_{0};
+  std::atomic<size_t> processed_items_{0};
+};
+
 }  // namespace
 
 Compactor::Compactor(RawHeap& heap) : heap_(heap) {
@@ -459,11 +570,20 @@ bool Compactor::ShouldCompact(
     return true;
   }
 
-  size_t free_list_size = UpdateHeapResidency(compactable_spaces_);
+  size_t free_list_size = UpdateHeapResidency(SelectSpacesToCompact());
 
   return free_list_size > kFreeListSizeThreshold;
 }
 
+std::vector<NormalPageSpace*> Compactor::SelectSpacesToCompact() const {
+  if (enable_for_next_gc_for_testing_) return compactable_spaces_;
+
+  std::vector<NormalPageSpace*> spaces;
+  std::copy_if(compactable_spaces_.begin(), compactable_spaces_.end(),
+               std::back_inserter(spaces), IsFragmented);
+  return spaces;
+}
+
 void Compactor::InitializeIfShouldCompact(
     GarbageCollector::Config::MarkingType marking_type,
     GarbageCollector::Config::StackState stack_state) {
@@ -472,6 +592,7 @@ void Compactor::InitializeIfShouldCompact(
   if (!ShouldCompact(marking_type, stack_state)) return;
 
   compaction_worklists_ = std::make_unique<CompactionWorklists>();
+  spaces_to_compact_ = SelectSpacesToCompact();
 
   is_enabled_ = true;
   is_cancelled_ = false;
@@ -492,12 +613,15 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
     compaction_worklists_->movable_slots_worklist()->Clear();
     compaction_worklists_.reset();
   }
-  if (!is_enabled_) return CompactableSpaceHandling::kSweep;
+  if (!is_enabled_) {
+    spaces_to_compact_.clear();
+    return CompactableSpaceHandling::kSweep;
+  }
 
   StatsCollector::EnabledScope stats_scope(heap_.heap()->stats_collector(),
                                            StatsCollector::kAtomicCompact);
 
-  MovableReferences movable_references(*heap_.heap());
+  MovableReferences movable_references(*heap_.heap(), spaces_to_compact_);
 
   CompactionWorklists::MovableReferencesWorklist::Local local(
       compaction_worklists_->movable_slots_worklist());
@@ -507,15 +631,42 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
   }
   compaction_worklists_.reset();
 
-  for (NormalPageSpace* space : compactable_spaces_) {
-    CompactSpace(space, movable_references);
+  std::vector<EvacuatedSpace> evacuated_spaces;
+  for (NormalPageSpace* space : spaces_to_compact_) {
+    FinalizeUnmarkedObjects(space);
+    evacuated_spaces.emplace_back(space);
   }
 
+  // Spaces are evacuated in parallel. Evacuation only records forwarding
+  // addresses; slots are updated in a separate parallel phase once all objects
+  // have reached their final location.
+  Platform* platform = heap_.heap()->platform();
+  ParallelCompactionJob::Run(
+      platform, evacuated_spaces.size(),
+      [&evacuated_spaces, &movable_references](size_t i) {
+        CompactSpace(evacuated_spaces[i], movable_references);
+      });
+  for (const EvacuatedSpace& evacuated_space : evacuated_spaces) {
+    movable_references.AddForwardingAddresses(evacuated_space);
+    for (NormalPage* page : evacuated_space.released_pages) {
+      NormalPage::Destroy(page);
+    }
+  }
+
+  ParallelCompactionJob::Run(
+      platform, movable_references.NumberOfSlotWorkItems(),
+      [&movable_references](size_t i) { movable_references.UpdateSlots(i); });
+
   enable_for_next_gc_for_testing_ = false;
   is_enabled_ = false;
   return CompactableSpaceHandling::kIgnore;
 }
 
+bool Compactor::IsCompactedSpace(const BaseSpace& space) const {
+  return std::find(spaces_to_compact_.begin(), spaces_to_compact_.end(),
+                   &space) != spaces_to_compact_.end();
+}
+
 void Compactor::EnableForNextGCForTesting() {
   DCHECK_NULL(heap_.heap()->marker());
   enable_for_next_gc_for_testing_ = true;
@@ -30,6 +30,10 @@ class V8_EXPORT_PRIVATE Compactor final {
                                 GarbageCollector::Config::StackState);
   CompactableSpaceHandling CompactSpacesIfEnabled();
 
+  // Returns whether |space| was evacuated by the last call to
+  // CompactSpacesIfEnabled(). Such spaces must not be swept.
+  bool IsCompactedSpace(const BaseSpace& space) const;
+
   CompactionWorklists* compaction_worklists() {
     return compaction_worklists_.get();
   }
@@ -40,10 +44,14 @@ class V8_EXPORT_PRIVATE Compactor final {
  private:
   bool ShouldCompact(GarbageCollector::Config::MarkingType,
                      GarbageCollector::Config::StackState) const;
+  std::vector<NormalPageSpace*> SelectSpacesToCompact() const;
 
   RawHeap& heap_;
   // Compactor does not own the compactable spaces. The heap owns all spaces.
   std::vector<NormalPageSpace*> compactable_spaces_;
+  // Subset of |compactable_spaces_| that is fragmented enough to be evacuated
+  // in the current cycle.
+  std::vector<NormalPageSpace*> spaces_to_compact_;
 
   std::unique_ptr<CompactionWorklists> compaction_worklists_;
 
@@ -118,6 +118,11 @@ void StatsCollector::NotifyMarkingStarted(CollectionType collection_type,
 void StatsCollector::NotifyMarkingCompleted(size_t marked_bytes) {
   DCHECK_EQ(GarbageCollectionState::kMarking, gc_state_);
   gc_state_ = GarbageCollectionState::kSweeping;
+  current_.marked_bytes_on_current_cycle = marked_bytes;
+  // Minor garbage collections do not mark old objects again.
+  if (current_.collection_type == CollectionType::kMinor) {
+    marked_bytes += previous_.marked_bytes;
+  }
   current_.marked_bytes = marked_bytes;
   current_.object_size_before_sweep_bytes =
       previous_.marked_bytes + allocated_bytes_since_end_of_marking_ +
@@ -222,7 +227,9 @@ void StatsCollector::NotifySweepingCompleted() {
   gc_state_ = GarbageCollectionState::kNotRunning;
   previous_ = std::move(current_);
   current_ = Event();
-  if (metric_recorder_) {
+  // Only full cycles are reported.
+  if (metric_recorder_ &&
+      previous_.collection_type == CollectionType::kMajor) {
     MetricRecorder::FullCycle event = GetFullCycleEventForMetricRecorder(
         previous_.scope_data[kAtomicMark].InMicroseconds(),
         previous_.scope_data[kAtomicWeak].InMicroseconds(),
@@ -271,6 +278,13 @@ size_t StatsCollector::marked_bytes() const {
   return event.marked_bytes;
 }
 
+size_t StatsCollector::marked_bytes_on_current_cycle() const {
+  DCHECK_NE(GarbageCollectionState::kMarking, gc_state_);
+  const Event& event =
+      gc_state_ == GarbageCollectionState::kSweeping ? current_ : previous_;
+  return event.marked_bytes_on_current_cycle;
+}
+
 v8::base::TimeDelta StatsCollector::marking_time() const {
   DCHECK_NE(GarbageCollectionState::kMarking, gc_state_);
   // During sweeping we refer to the current Event as that already holds the
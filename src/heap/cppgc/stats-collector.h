@@ -106,8 +106,11 @@ class V8_EXPORT_PRIVATE StatsCollector final {
     size_t epoch = -1;
     CollectionType collection_type = CollectionType::kMajor;
     IsForcedGC is_forced_gc = IsForcedGC::kNotForced;
-    // Marked bytes collected during marking.
+    // Marked bytes collected during marking. For minor garbage collections
+    // this includes the old objects that are live by definition.
     size_t marked_bytes = 0;
+    // Bytes marked by the marker in this cycle.
+    size_t marked_bytes_on_current_cycle = 0;
     size_t object_size_before_sweep_bytes = -1;
     size_t memory_size_before_sweep_bytes = -1;
   };
@@ -284,6 +287,10 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // Returns the most recent marked bytes count. Should not be called during
   // marking.
   size_t marked_bytes() const;
+  // Returns the bytes marked by the most recent marking phase, which excludes
+  // old objects for minor garbage collections. Should not be called during
+  // marking.
+  size_t marked_bytes_on_current_cycle() const;
   // Returns the overall duration of the most recent marking phase. Should not
   // be called during marking.
   v8::base::TimeDelta marking_time() const;
@@ -11,6 +11,7 @@
 #include "include/cppgc/platform.h"
 #include "src/base/optional.h"
 #include "src/base/platform/mutex.h"
+#include "src/heap/cppgc/compactor.h"
 #include "src/heap/cppgc/free-list.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/heap-base.h"
@@ -652,9 +653,11 @@ class PrepareForSweepVisitor final
 
  public:
   PrepareForSweepVisitor(SpaceStates* states,
-                         CompactableSpaceHandling compactable_space_handling)
+                         CompactableSpaceHandling compactable_space_handling,
+                         const Compactor& compactor)
       : states_(states),
-        compactable_space_handling_(compactable_space_handling) {
+        compactable_space_handling_(compactable_space_handling),
+        compactor_(compactor) {
     DCHECK_NOT_NULL(states);
   }
 
@@ -666,8 +669,10 @@ class PrepareForSweepVisitor final
 
  protected:
   bool VisitNormalPageSpace(NormalPageSpace& space) {
+    // Only spaces that were actually evacuated are ignored. Compactable spaces
+    // that were not fragmented enough are swept as usual.
     if ((compactable_space_handling_ == CompactableSpaceHandling::kIgnore) &&
-        space.is_compactable())
+        space.is_compactable() && compactor_.IsCompactedSpace(space))
       return true;
     DCHECK(!space.linear_allocation_buffer().size());
     space.free_list().Clear();
@@ -695,6 +700,7 @@ class PrepareForSweepVisitor final
 
   SpaceStates* states_;
   CompactableSpaceHandling compactable_space_handling_;
+  const Compactor& compactor_;
 };
 
 }  // namespace
@@ -731,7 +737,8 @@ class Sweeper::SweeperImpl final {
       heap_.heap()->stats_collector()->ResetDiscardedMemory();
     }
 
-    PrepareForSweepVisitor(&space_states_, config.compactable_space_handling)
+    PrepareForSweepVisitor(&space_states_, config.compactable_space_handling,
+                           heap_.heap()->compactor())
         .Run(heap_);
 
     if (config.sweeping_type == SweepingConfig::SweepingType::kAtomic) {
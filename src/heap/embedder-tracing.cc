@@ -43,7 +43,9 @@ CppHeap::GarbageCollectionFlags ConvertTraceFlags(
 
 void LocalEmbedderHeapTracer::PrepareForTrace(
     EmbedderHeapTracer::TraceFlags flags) {
-  if (cpp_heap_) cpp_heap()->InitializeTracing(ConvertTraceFlags(flags));
+  if (cpp_heap_)
+    cpp_heap()->InitializeTracing(CppHeap::CollectionType::kMajor,
+                                  ConvertTraceFlags(flags));
 }
 
 void LocalEmbedderHeapTracer::TracePrologue(
@@ -205,6 +207,16 @@ void LocalEmbedderHeapTracer::EmbedderWriteBarrier(Heap* heap,
   scope.TracePossibleWrapper(js_object);
 }
 
+void LocalEmbedderHeapTracer::EmbedderGenerationalBarrier(JSObject js_object) {
+  DCHECK(InUse());
+  DCHECK(js_object.IsApiWrapper());
+  if (!cpp_heap_) return;
+  WrapperInfo info;
+  if (ExtractWrappableInfo(isolate_, js_object, wrapper_descriptor(), &info)) {
+    cpp_heap()->RememberCrossHeapReferenceIfNeeded(info.second);
+  }
+}
+
 bool DefaultEmbedderRootsHandler::IsRoot(
     const v8::TracedReference<v8::Value>& handle) {
   return !tracer_ || tracer_->IsRootForNonTracingGC(handle);
@@ -155,6 +155,7 @@ class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
   }
 
   void EmbedderWriteBarrier(Heap*, JSObject);
+  void EmbedderGenerationalBarrier(JSObject);
 
  private:
   static constexpr size_t kEmbedderAllocatedThreshold = 128 * KB;
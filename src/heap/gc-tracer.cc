@@ -253,6 +253,9 @@ void GCTracer::ResetForTesting() {
   average_mark_compact_duration_ = 0;
   current_mark_compact_mutator_utilization_ = 1.0;
   previous_mark_compact_end_time_ = 0;
+  atomic_pause_target_ = -1.0;
+  atomic_pause_target_overshoot_ = -1.0;
+  atomic_pause_target_misses_ = 0;
   base::MutexGuard guard(&background_counter_mutex_);
   for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
     background_counter_[i].total_duration_ms = 0;
@@ -404,6 +407,7 @@ void GCTracer::Stop(GarbageCollector collector) {
       recorded_incremental_mark_compacts_.Push(
           MakeBytesAndDuration(current_.end_object_size, duration));
       RecordGCSumCounters(duration);
+      RecordAtomicPauseTarget(duration);
       ResetIncrementalMarkingCounters();
       combined_mark_compact_speed_cache_ = 0.0;
       FetchBackgroundMarkCompactCounters();
@@ -417,6 +421,10 @@ void GCTracer::Stop(GarbageCollector collector) {
       recorded_mark_compacts_.Push(
           MakeBytesAndDuration(current_.end_object_size, duration));
       RecordGCSumCounters(duration);
+      // A non-incremental cycle has no atomic pause target. Don't report the
+      // one of the previous incremental cycle for it.
+      atomic_pause_target_ = -1.0;
+      atomic_pause_target_overshoot_ = -1.0;
       ResetIncrementalMarkingCounters();
       combined_mark_compact_speed_cache_ = 0.0;
       FetchBackgroundMarkCompactCounters();
@@ -1395,6 +1403,25 @@ void FlushBatchedIncrementalEvents(
 
 }  // namespace
 
+void GCTracer::RecordAtomicPauseTarget(double atomic_pause_duration) {
+  if (FLAG_incremental_marking_pause_target <= 0) {
+    atomic_pause_target_ = -1.0;
+    atomic_pause_target_overshoot_ = -1.0;
+    return;
+  }
+  atomic_pause_target_ = FLAG_incremental_marking_pause_target;
+  atomic_pause_target_overshoot_ =
+      std::max(0.0, atomic_pause_duration - atomic_pause_target_);
+  if (atomic_pause_target_overshoot_ == 0.0) return;
+  atomic_pause_target_misses_++;
+  if (FLAG_trace_incremental_marking) {
+    heap_->isolate()->PrintWithTimestamp(
+        "[IncrementalMarking] Atomic pause of %.1fms missed the target of "
+        "%.1fms\n",
+        atomic_pause_duration, atomic_pause_target_);
+  }
+}
+
 void GCTracer::ReportFullCycleToRecorder() {
   const std::shared_ptr<metrics::Recorder>& recorder =
       heap_->isolate()->metrics_recorder();
@@ -1442,6 +1469,13 @@ void GCTracer::ReportFullCycleToRecorder() {
     event.main_thread_efficiency_cpp_in_bytes_per_us =
         cppgc_event.main_thread_efficiency_in_bytes_per_us;
   }
+  if (atomic_pause_target_ >= 0) {
+    event.atomic_pause_target_in_us = static_cast<int64_t>(
+        atomic_pause_target_ * base::Time::kMicrosecondsPerMillisecond);
+    event.atomic_pause_target_overshoot_in_us =
+        static_cast<int64_t>(atomic_pause_target_overshoot_ *
+                             base::Time::kMicrosecondsPerMillisecond);
+  }
   // TODO(chromium:1154636): Populate v8 metrics.
   recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
 }
@@ -349,6 +349,12 @@ class V8_EXPORT_PRIVATE GCTracer {
   double AverageTimeToIncrementalMarkingTask() const;
   void RecordTimeToIncrementalMarkingTask(double time_to_task);
 
+  // Returns the number of incremental mark-compacts whose atomic pause
+  // exceeded --incremental-marking-pause-target.
+  size_t atomic_pause_target_misses() const {
+    return atomic_pause_target_misses_;
+  }
+
 #ifdef V8_RUNTIME_CALL_STATS
   WorkerThreadRuntimeCallStats* worker_thread_runtime_call_stats();
 #endif  // defined(V8_RUNTIME_CALL_STATS)
@@ -358,6 +364,7 @@ class V8_EXPORT_PRIVATE GCTracer {
  private:
   FRIEND_TEST(GCTracer, AverageSpeed);
   FRIEND_TEST(GCTracerTest, AllocationThroughput);
+  FRIEND_TEST(GCTracerTest, AtomicPauseTarget);
   FRIEND_TEST(GCTracerTest, BackgroundScavengerScope);
   FRIEND_TEST(GCTracerTest, BackgroundMinorMCScope);
   FRIEND_TEST(GCTracerTest, BackgroundMajorMCScope);
@@ -397,6 +404,10 @@ class V8_EXPORT_PRIVATE GCTracer {
   // recording takes place at the end of the atomic pause.
   void RecordGCSumCounters(double atomic_pause_duration);
 
+  // Checks the atomic pause of an incremental mark-compact against
+  // --incremental-marking-pause-target.
+  void RecordAtomicPauseTarget(double atomic_pause_duration);
+
   double MonotonicallyIncreasingTimeInMs();
 
   // Print one detailed trace line in name=value format.
@@ -454,6 +465,12 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   double recorded_embedder_speed_ = 0.0;
 
+  // Pause-time target and its overshoot (in ms) of the last incremental
+  // mark-compact. Negative if no target was set.
+  double atomic_pause_target_ = -1.0;
+  double atomic_pause_target_overshoot_ = -1.0;
+  size_t atomic_pause_target_misses_ = 0;
+
   // Incremental scopes carry more information than just the duration. The infos
   // here are merged back upon starting/stopping the GC tracer.
   IncrementalMarkingInfos
@@ -159,6 +159,12 @@ void Heap::SetPendingOptimizeForTestBytecode(Object hash_table) {
   roots_table()[RootIndex::kPendingOptimizeForTestBytecode] = hash_table.ptr();
 }
 
+void Heap::SetContextAllocationSites(Object hash_table) {
+  DCHECK(hash_table.IsEphemeronHashTable() ||
+         hash_table.IsUndefined(isolate()));
+  roots_table()[RootIndex::kContextAllocationSites] = hash_table.ptr();
+}
+
 PagedSpace* Heap::paged_space(int idx) {
   DCHECK(idx == OLD_SPACE || idx == CODE_SPACE || idx == MAP_SPACE);
   return static_cast<PagedSpace*>(space_[idx]);
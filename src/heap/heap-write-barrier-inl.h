@@ -283,6 +283,15 @@ void WriteBarrier::MarkingFromInternalFields(JSObject host) {
   MarkingSlowFromInternalFields(*heap, host);
 }
 
+// static
+void WriteBarrier::GenerationalFromInternalFields(JSObject host) {
+  if (!FLAG_cppgc_young_generation) return;
+  heap_internals::MemoryChunk* chunk =
+      heap_internals::MemoryChunk::FromHeapObject(host);
+  if (chunk->InYoungGeneration()) return;
+  GenerationalSlowFromInternalFields(chunk->GetHeap(), host);
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -57,6 +57,14 @@ void WriteBarrier::MarkingSlowFromInternalFields(Heap* heap, JSObject host) {
   local_embedder_heap_tracer->EmbedderWriteBarrier(heap, host);
 }
 
+// static
+void WriteBarrier::GenerationalSlowFromInternalFields(Heap* heap,
+                                                      JSObject host) {
+  auto* local_embedder_heap_tracer = heap->local_embedder_heap_tracer();
+  if (!local_embedder_heap_tracer->InUse()) return;
+  local_embedder_heap_tracer->EmbedderGenerationalBarrier(host);
+}
+
 void WriteBarrier::MarkingSlow(Heap* heap, Code host, RelocInfo* reloc_info,
                                HeapObject value) {
   MarkingBarrier* marking_barrier = current_marking_barrier
@@ -59,6 +59,9 @@ class V8_EXPORT_PRIVATE WriteBarrier {
   // Invoked from global handles where no host object is available.
   static inline void MarkingFromGlobalHandle(Object value);
   static inline void MarkingFromInternalFields(JSObject host);
+  // Records references from old wrappers to young C++ objects for
+  // --cppgc-young-generation.
+  static inline void GenerationalFromInternalFields(JSObject host);
 
   static void SetForThread(MarkingBarrier*);
   static void ClearForThread(MarkingBarrier*);
@@ -77,6 +80,7 @@ class V8_EXPORT_PRIVATE WriteBarrier {
                           int number_of_own_descriptors);
   static void MarkingSlowFromGlobalHandle(Heap* heap, HeapObject value);
   static void MarkingSlowFromInternalFields(Heap* heap, JSObject host);
+  static void GenerationalSlowFromInternalFields(Heap* heap, JSObject host);
 };
 
 }  // namespace internal
@@ -1234,6 +1234,42 @@ void Heap::PretenureAllocationSiteOnNextCollection(AllocationSite site) {
   allocation_sites_to_pretenure_->Push(site);
 }
 
+MaybeHandle<AllocationSite> Heap::GetOrCreateContextAllocationSite(
+    Handle<SharedFunctionInfo> caller, Handle<AllocationSite> site) {
+  // The table maps each caller to a FixedArray of (site, context site) pairs.
+  // Entries die together with their caller.
+  static constexpr int kMaxSitesPerCaller = 16;
+  Handle<EphemeronHashTable> table =
+      context_allocation_sites().IsUndefined(isolate())
+          ? EphemeronHashTable::New(isolate(), 1, AllocationType::kOld)
+          : handle(EphemeronHashTable::cast(context_allocation_sites()),
+                   isolate());
+  Handle<FixedArray> pairs;
+  Object entry = table->Lookup(caller);
+  if (entry.IsFixedArray()) {
+    pairs = handle(FixedArray::cast(entry), isolate());
+    for (int i = 0; i < pairs->length(); i += 2) {
+      if (pairs->get(i) == *site) {
+        return handle(AllocationSite::cast(pairs->get(i + 1)), isolate());
+      }
+    }
+    if (pairs->length() >= 2 * kMaxSitesPerCaller) return {};
+    pairs = isolate()->factory()->CopyFixedArrayAndGrow(pairs, 2);
+  } else {
+    pairs = isolate()->factory()->NewFixedArray(2, AllocationType::kOld);
+  }
+
+  // The context site only carries pretenuring state; the boilerplate and its
+  // elements kind stay with {site}.
+  Handle<AllocationSite> context_site =
+      isolate()->factory()->NewAllocationSite(true);
+  pairs->set(pairs->length() - 2, *site);
+  pairs->set(pairs->length() - 1, *context_site);
+  table = EphemeronHashTable::Put(table, caller, pairs);
+  SetContextAllocationSites(*table);
+  return context_site;
+}
+
 void Heap::InvalidateCodeDeoptimizationData(Code code) {
   CodePageMemoryModificationScope modification_scope(code);
   code.set_deoptimization_data(ReadOnlyRoots(this).empty_fixed_array());
@@ -5603,7 +5639,7 @@ void Heap::SetUp(LocalHeap* main_thread_local_heap) {
       // CodeRange. isolate_->page_allocator() is the process-wide pointer
       // compression cage's PageAllocator.
       code_range_ = CodeRange::EnsureProcessWideCodeRange(
-          isolate_->page_allocator(), requested_size);
+          isolate_->cage_base(), isolate_->page_allocator(), requested_size);
     } else {
       code_range_ = std::make_shared<CodeRange>();
       if (!code_range_->InitReservation(isolate_->page_allocator(),
@@ -7151,7 +7187,8 @@ Code Heap::GcSafeFindCodeForInnerPointer(Address inner_pointer) {
     }
   }
   // TODO(1241665): Remove once the issue is solved.
-  std::shared_ptr<CodeRange> code_range = CodeRange::GetProcessWideCodeRange();
+  std::shared_ptr<CodeRange> code_range =
+      CodeRange::GetProcessWideCodeRange(isolate()->cage_base());
   void* code_range_embedded_blob_code_copy =
       code_range ? code_range->embedded_blob_code_copy() : nullptr;
   Address flags = (isolate()->is_short_builtin_calls_enabled() ? 1 : 0) |
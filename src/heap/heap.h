@@ -957,6 +957,7 @@ class Heap {
   V8_INLINE void SetRootNoScriptSharedFunctionInfos(Object value);
   V8_INLINE void SetMessageListeners(TemplateList value);
   V8_INLINE void SetPendingOptimizeForTestBytecode(Object bytecode);
+  V8_INLINE void SetContextAllocationSites(Object hash_table);
 
   StrongRootsEntry* RegisterStrongRoots(const char* label, FullObjectSlot start,
                                         FullObjectSlot end);
@@ -1556,6 +1557,12 @@ class Heap {
   V8_EXPORT_PRIVATE void PretenureAllocationSiteOnNextCollection(
       AllocationSite site);
 
+  // Returns the allocation site that collects pretenuring feedback for the
+  // literal of {site} when it is inlined into optimized code of {caller}.
+  // Returns an empty handle if {caller} already tracks too many sites.
+  MaybeHandle<AllocationSite> GetOrCreateContextAllocationSite(
+      Handle<SharedFunctionInfo> caller, Handle<AllocationSite> site);
+
   // ===========================================================================
   // Allocation tracking. ======================================================
   // ===========================================================================
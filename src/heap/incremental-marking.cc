@@ -205,6 +205,10 @@ void IncrementalMarking::Start(GarbageCollectionReason gc_reason) {
   scheduled_bytes_to_mark_ = 0;
   schedule_update_time_ms_ = start_time_ms_;
   bytes_marked_concurrently_ = 0;
+  pause_target_update_time_ms_ = start_time_ms_;
+  pause_target_bytes_marked_concurrently_ = 0;
+  concurrent_marking_speed_ = 0.0;
+  behind_pause_target_ = false;
   was_activated_ = true;
 
   StartMarking();
@@ -727,6 +731,11 @@ void IncrementalMarking::MarkingComplete(CompletionAction action) {
 }
 
 void IncrementalMarking::Epilogue() {
+  if (was_activated_ && initial_old_generation_size_ > 0) {
+    old_generation_survival_ratio_ = std::min(
+        1.0, static_cast<double>(heap_->OldGenerationSizeOfObjects()) /
+                 initial_old_generation_size_);
+  }
   was_activated_ = false;
   finalize_marking_completed_ = false;
 }
@@ -796,9 +805,13 @@ StepResult IncrementalMarking::AdvanceWithDeadline(
                  ThreadKind::kMain);
   DCHECK(!IsStopped());
 
-  ScheduleBytesToMarkBasedOnTime(heap()->MonotonicallyIncreasingTimeInMs());
+  const double now = heap()->MonotonicallyIncreasingTimeInMs();
+  ScheduleBytesToMarkBasedOnTime(now);
+  ScheduleBytesToMarkBasedOnPauseTarget(now);
   FastForwardScheduleIfCloseToFinalization();
-  return Step(kStepSizeInMs, completion_action, step_origin);
+  // Tasks make larger steps while the marker is behind the pause target.
+  return Step(behind_pause_target_ ? kMaxStepSizeInMs : kStepSizeInMs,
+              completion_action, step_origin);
 }
 
 size_t IncrementalMarking::StepSizeToKeepUpWithAllocations() {
@@ -847,6 +860,98 @@ void IncrementalMarking::ScheduleBytesToMarkBasedOnAllocation() {
   }
 }
 
+size_t IncrementalMarking::EstimatedBytesLeftToMark() const {
+  const size_t live_bytes = static_cast<size_t>(
+      initial_old_generation_size_ * old_generation_survival_ratio_);
+  return live_bytes > bytes_marked_ ? live_bytes - bytes_marked_ : 0;
+}
+
+double IncrementalMarking::AtomicPauseMarkingSpeed() const {
+  GCTracer* tracer = heap_->tracer();
+  double speed =
+      tracer->FinalIncrementalMarkCompactSpeedInBytesPerMillisecond();
+  if (speed == 0.0) speed = tracer->MarkCompactSpeedInBytesPerMillisecond();
+  if (speed == 0.0) speed = GCTracer::kConservativeSpeedInBytesPerMillisecond;
+  return speed;
+}
+
+double IncrementalMarking::PredictAtomicPauseInMs() const {
+  return EstimatedBytesLeftToMark() / AtomicPauseMarkingSpeed();
+}
+
+void IncrementalMarking::ScheduleBytesToMarkBasedOnPauseTarget(
+    double time_ms) {
+  // Assumed time until finalization if nothing is known about allocations.
+  constexpr double kDefaultTimeToFinalizationInMs = 500;
+  constexpr double kMinTimeBetweenScheduleInMs = 10;
+  const double target_ms = FLAG_incremental_marking_pause_target;
+  if (target_ms <= 0 || state_ != MARKING) return;
+  if (pause_target_update_time_ms_ + kMinTimeBetweenScheduleInMs > time_ms) {
+    return;
+  }
+  const double delta_ms = time_ms - pause_target_update_time_ms_;
+  pause_target_update_time_ms_ = time_ms;
+
+  FetchBytesMarkedConcurrently();
+  const double concurrent_speed =
+      (bytes_marked_concurrently_ - pause_target_bytes_marked_concurrently_) /
+      delta_ms;
+  pause_target_bytes_marked_concurrently_ = bytes_marked_concurrently_;
+  concurrent_marking_speed_ =
+      concurrent_marking_speed_ == 0.0
+          ? concurrent_speed
+          : (concurrent_marking_speed_ + concurrent_speed) / 2;
+
+  // Marking is finalized at the latest when allocations hit the old
+  // generation limit, regardless of the work that is left.
+  const double allocation_speed =
+      heap_->tracer()
+          ->CurrentOldGenerationAllocationThroughputInBytesPerMillisecond();
+  const double time_left_ms =
+      allocation_speed > 0
+          ? std::max(delta_ms,
+                     heap_->OldGenerationSpaceAvailable() / allocation_speed)
+          : kDefaultTimeToFinalizationInMs;
+
+  // Work that neither concurrent marking until finalization nor the atomic
+  // pause within its target can take over. It is spread over the time left.
+  const double pause_speed = AtomicPauseMarkingSpeed();
+  const double excess_bytes = EstimatedBytesLeftToMark() -
+                              concurrent_marking_speed_ * time_left_ms -
+                              target_ms * pause_speed;
+  const bool was_behind = behind_pause_target_;
+  behind_pause_target_ = excess_bytes > 0;
+  if (FLAG_concurrent_marking && was_behind != behind_pause_target_) {
+    // Concurrent marking runs at user-blocking priority only until the marker
+    // is back within the target.
+    if (behind_pause_target_) {
+      heap_->concurrent_marking()->RescheduleJobIfNeeded(
+          ConcurrentMarkingPriority());
+    } else {
+      heap_->concurrent_marking()->UpdateJobPriority(
+          ConcurrentMarkingPriority());
+    }
+  }
+  if (!behind_pause_target_) return;
+
+  const size_t bytes_to_mark =
+      static_cast<size_t>(excess_bytes * delta_ms / time_left_ms);
+  AddScheduledBytesToMark(bytes_to_mark);
+
+  if (FLAG_trace_incremental_marking) {
+    heap_->isolate()->PrintWithTimestamp(
+        "[IncrementalMarking] Scheduled %zuKB to mark based on pause target "
+        "(predicted pause=%.1fms, target=%.1fms, time left=%.1fms)\n",
+        bytes_to_mark / KB, PredictAtomicPauseInMs(), target_ms,
+        time_left_ms);
+  }
+}
+
+TaskPriority IncrementalMarking::ConcurrentMarkingPriority() const {
+  return behind_pause_target_ ? TaskPriority::kUserBlocking
+                              : TaskPriority::kUserVisible;
+}
+
 void IncrementalMarking::FetchBytesMarkedConcurrently() {
   if (FLAG_concurrent_marking) {
     size_t current_bytes_marked_concurrently =
@@ -880,8 +985,10 @@ size_t IncrementalMarking::ComputeStepSizeInBytes(StepOrigin step_origin) {
     }
   }
   // Allow steps on allocation to get behind the schedule by small ammount.
-  // This gives higher priority to steps in tasks.
-  size_t kScheduleMarginInBytes = step_origin == StepOrigin::kV8 ? 1 * MB : 0;
+  // This gives higher priority to steps in tasks. No margin is left while the
+  // marker is behind the pause target, which slows down allocations instead.
+  size_t kScheduleMarginInBytes =
+      step_origin == StepOrigin::kV8 && !behind_pause_target_ ? 1 * MB : 0;
   if (bytes_marked_ + kScheduleMarginInBytes > scheduled_bytes_to_mark_)
     return 0;
   return scheduled_bytes_to_mark_ - bytes_marked_ - kScheduleMarginInBytes;
@@ -900,6 +1007,8 @@ void IncrementalMarking::AdvanceOnAllocation() {
   TRACE_GC_EPOCH(heap_->tracer(), GCTracer::Scope::MC_INCREMENTAL,
                  ThreadKind::kMain);
   ScheduleBytesToMarkBasedOnAllocation();
+  ScheduleBytesToMarkBasedOnPauseTarget(
+      heap()->MonotonicallyIncreasingTimeInMs());
   Step(kMaxStepSizeInMs, GC_VIA_STACK_GUARD, StepOrigin::kV8);
 }
 
@@ -980,7 +1089,8 @@ StepResult IncrementalMarking::Step(double max_step_size_in_ms,
     }
     if (FLAG_concurrent_marking) {
       local_marking_worklists()->ShareWork();
-      heap_->concurrent_marking()->RescheduleJobIfNeeded();
+      heap_->concurrent_marking()->RescheduleJobIfNeeded(
+          ConcurrentMarkingPriority());
     }
   }
   if (state_ == MARKING) {
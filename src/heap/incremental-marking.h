@@ -10,6 +10,7 @@
 #include "src/heap/incremental-marking-job.h"
 #include "src/heap/mark-compact.h"
 #include "src/tasks/cancelable-task.h"
+#include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
 namespace internal {
@@ -222,6 +223,8 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   }
 
  private:
+  FRIEND_TEST(IncrementalMarkingTest, PauseTargetSchedulesBytesToMark);
+
   class Observer : public AllocationObserver {
    public:
     Observer(IncrementalMarking* incremental_marking, intptr_t step_size)
@@ -259,6 +262,17 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   size_t StepSizeToMakeProgress();
   void AddScheduledBytesToMark(size_t bytes_to_mark);
 
+  // Updates scheduled_bytes_to_mark_ so that the work left for the atomic
+  // pause fits into --incremental-marking-pause-target. Also raises the
+  // priority of concurrent marking while the marker is behind.
+  // ConcurrentMarkingPriority() returns the priority for the current state.
+  void ScheduleBytesToMarkBasedOnPauseTarget(double time_ms);
+  TaskPriority ConcurrentMarkingPriority() const;
+  // Predicts the duration of the atomic pause if marking was finalized now.
+  double PredictAtomicPauseInMs() const;
+  size_t EstimatedBytesLeftToMark() const;
+  double AtomicPauseMarkingSpeed() const;
+
   // Schedules more bytes to mark so that the marker is no longer ahead
   // of schedule.
   void FastForwardSchedule();
@@ -296,6 +310,15 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   // bytes_marked_ahead_of_schedule_ with contribution of concurrent marking.
   size_t bytes_marked_concurrently_ = 0;
 
+  // State of the pause-time based schedule.
+  double pause_target_update_time_ms_ = 0.0;
+  size_t pause_target_bytes_marked_concurrently_ = 0;
+  double concurrent_marking_speed_ = 0.0;
+  bool behind_pause_target_ = false;
+  // Ratio of surviving old generation bytes in the last incremental
+  // mark-compact. Used for estimating the live bytes left to mark.
+  double old_generation_survival_ratio_ = 1.0;
+
   // Must use SetState() above to update state_
   // Atomic since main thread can complete marking (= changing state), while a
   // background thread's slow allocation path will check whether incremental
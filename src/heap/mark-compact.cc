@@ -37,6 +37,7 @@
 #include "src/heap/memory-measurement.h"
 #include "src/heap/object-stats.h"
 #include "src/heap/objects-visiting-inl.h"
+#include "src/heap/paged-spaces-inl.h"
 #include "src/heap/parallel-work-item.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/read-only-spaces.h"
@@ -4969,6 +4970,23 @@ void MinorMarkCompactCollector::SweepArrayBufferExtensions() {
       ArrayBufferSweeper::SweepingType::kYoung);
 }
 
+void MinorMarkCompactCollector::RefillFreeListsOfPromotedPages() {
+  if (!FLAG_minor_mc_sweep_promoted_pages) return;
+  PagedSpace* old_space = heap()->old_space();
+  base::MutexGuard guard(old_space->mutex());
+  for (Page* p : new_space_evacuation_pages_) {
+    if (!p->IsFlagSet(Page::PAGE_NEW_OLD_PROMOTION)) continue;
+    DCHECK_EQ(old_space, p->owner());
+    // The page was accounted as fully allocated when it was moved to old
+    // space. The evacuator already freed the dead space on the page into its
+    // free list categories, which also updated the page's own counter.
+    DCHECK_GE(p->area_size(), p->allocated_bytes());
+    old_space->DecreaseAllocatedBytes(p->area_size() - p->allocated_bytes(),
+                                      p);
+    old_space->RelinkFreeListCategories(p);
+  }
+}
+
 class YoungGenerationMigrationObserver final : public MigrationObserver {
  public:
   YoungGenerationMigrationObserver(Heap* heap,
@@ -5178,8 +5196,11 @@ void MinorMarkCompactCollector::CollectGarbage() {
 
 void MinorMarkCompactCollector::MakeIterable(
     Page* p, MarkingTreatmentMode marking_mode,
-    FreeSpaceTreatmentMode free_space_mode) {
+    FreeSpaceTreatmentMode free_space_mode,
+    Sweeper::FreeListRebuildingMode free_list_mode) {
   CHECK(!p->IsLargePage());
+  DCHECK_IMPLIES(free_list_mode == Sweeper::REBUILD_FREE_LIST,
+                 p->owner_identity() == OLD_SPACE);
   // We have to clear the full collectors markbits for the areas that we
   // remove here.
   MarkCompactCollector* full_collector = heap()->mark_compact_collector();
@@ -5201,6 +5222,9 @@ void MinorMarkCompactCollector::MakeIterable(
       }
       p->heap()->CreateFillerObjectAt(free_start, static_cast<int>(size),
                                       ClearRecordedSlots::kNo);
+      if (free_list_mode == Sweeper::REBUILD_FREE_LIST) {
+        static_cast<PagedSpace*>(p->owner())->UnaccountedFree(free_start, size);
+      }
     }
     PtrComprCageBase cage_base(p->heap()->isolate());
     Map map = object.map(cage_base, kAcquireLoad);
@@ -5219,6 +5243,9 @@ void MinorMarkCompactCollector::MakeIterable(
     }
     p->heap()->CreateFillerObjectAt(free_start, static_cast<int>(size),
                                     ClearRecordedSlots::kNo);
+    if (free_list_mode == Sweeper::REBUILD_FREE_LIST) {
+      static_cast<PagedSpace*>(p->owner())->UnaccountedFree(free_start, size);
+    }
   }
 
   if (marking_mode == MarkingTreatmentMode::CLEAR) {
@@ -5731,6 +5758,13 @@ void MinorMarkCompactCollector::Evacuate() {
 
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_EVACUATE_CLEAN_UP);
+    RefillFreeListsOfPromotedPages();
+    // Moved pages keep their young generation mark bits until the next GC,
+    // as UpdateMarkingWorklistAfterScavenge still uses them to filter dead
+    // objects. This is also fine for promoted pages whose free lists were
+    // refilled above: the mark bits are only read during this GC, before
+    // anything is allocated on the page, and CleanupSweepToIteratePages only
+    // clears them again. Nothing re-sweeps SWEEP_TO_ITERATE pages.
     for (Page* p : new_space_evacuation_pages_) {
       if (p->IsFlagSet(Page::PAGE_NEW_NEW_PROMOTION) ||
           p->IsFlagSet(Page::PAGE_NEW_OLD_PROMOTION)) {
@@ -5797,7 +5831,16 @@ void YoungGenerationEvacuator::RawEvacuatePage(MemoryChunk* chunk,
       new_to_old_page_visitor_.account_moved_bytes(
           marking_state->live_bytes(chunk));
       if (!chunk->IsLargePage()) {
-        if (heap()->ShouldZapGarbage()) {
+        if (FLAG_minor_mc_sweep_promoted_pages) {
+          // Sweep the promoted page right away so that its free space can be
+          // reused without waiting for the next full GC. This also clears
+          // the full collector's mark bits in the free space. The young
+          // generation mark bits are kept for pointer updating.
+          collector_->MakeIterable(
+              static_cast<Page*>(chunk), MarkingTreatmentMode::KEEP,
+              heap()->ShouldZapGarbage() ? ZAP_FREE_SPACE : IGNORE_FREE_SPACE,
+              Sweeper::REBUILD_FREE_LIST);
+        } else if (heap()->ShouldZapGarbage()) {
           collector_->MakeIterable(static_cast<Page*>(chunk),
                                    MarkingTreatmentMode::KEEP, ZAP_FREE_SPACE);
         } else if (heap()->incremental_marking()->IsMarking()) {
@@ -859,8 +859,15 @@ class MinorMarkCompactCollector final : public MarkCompactCollectorBase {
   void TearDown() override;
   void CollectGarbage() override;
 
+  // Fills the free space between marked objects on {page} with filler
+  // objects. With REBUILD_FREE_LIST, which is only valid for pages promoted
+  // to old space, the free space is also added to the page's free list
+  // categories without linking them to the space's free list; see
+  // RefillFreeListsOfPromotedPages.
   void MakeIterable(Page* page, MarkingTreatmentMode marking_mode,
-                    FreeSpaceTreatmentMode free_space_mode);
+                    FreeSpaceTreatmentMode free_space_mode,
+                    Sweeper::FreeListRebuildingMode free_list_mode =
+                        Sweeper::IGNORE_FREE_LIST);
   void CleanupSweepToIteratePages();
 
  private:
@@ -900,6 +907,7 @@ class MinorMarkCompactCollector final : public MarkCompactCollectorBase {
       std::vector<std::unique_ptr<UpdatingItem>>* items);
 
   void SweepArrayBufferExtensions();
+  void RefillFreeListsOfPromotedPages();
 
   MarkingWorklist* worklist_;
   MarkingWorklist::Local main_thread_worklist_local_;
@@ -35,12 +35,14 @@ MemoryAllocator::MemoryAllocator(Isolate* isolate,
       size_executable_(0),
       lowest_ever_allocated_(static_cast<Address>(-1ll)),
       highest_ever_allocated_(kNullAddress),
-      unmapper_(isolate->heap(), this) {
+      unmapper_(isolate->heap(), this),
+      huge_page_pool_(this) {
   DCHECK_NOT_NULL(code_page_allocator);
 }
 
 void MemoryAllocator::TearDown() {
   unmapper()->TearDown();
+  huge_page_pool()->TearDown();
 
   // Check that spaces were torn down before MemoryAllocator.
   DCHECK_EQ(size_, 0u);
@@ -167,6 +169,7 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks(
       allocator_->FreePooledChunk(chunk);
       if (delegate && delegate->ShouldYield()) return;
     }
+    allocator_->huge_page_pool()->ReleaseFreeRegions();
   }
   PerformFreeMemoryOnQueuedNonRegularChunks();
 }
@@ -194,9 +197,10 @@ int MemoryAllocator::Unmapper::NumberOfChunks() {
 }
 
 size_t MemoryAllocator::Unmapper::CommittedBufferedMemory() {
-  base::MutexGuard guard(&mutex_);
+  // Free pages of the huge page pool stay committed.
+  size_t sum = allocator_->huge_page_pool()->CommittedFreeMemory();
 
-  size_t sum = 0;
+  base::MutexGuard guard(&mutex_);
   // kPooled chunks are already uncommited. We only have to account for
   // kRegular and kNonRegular chunks.
   for (auto& chunk : chunks_[kRegular]) {
@@ -208,6 +212,102 @@ size_t MemoryAllocator::Unmapper::CommittedBufferedMemory() {
   return sum;
 }
 
+Address MemoryAllocator::HugePagePool::Allocate() {
+  base::MutexGuard guard(&mutex_);
+  if (free_pages_ > 0) {
+    for (auto& entry : regions_) {
+      Address page = AllocateFromRegion(entry.first, entry.second.get());
+      if (page != kNullAddress) return page;
+    }
+    UNREACHABLE();
+  }
+
+  // Commit the whole region at once, so that it stays a single mapping.
+  v8::PageAllocator* page_allocator = allocator_->data_page_allocator();
+#ifdef V8_COMPRESS_POINTERS
+  void* address_hint = nullptr;
+#else
+  void* address_hint = AlignedAddress(
+      allocator_->isolate_->heap()->GetRandomMmapAddr(), kRegionSize);
+#endif
+  auto region = std::make_unique<Region>();
+  region->reservation =
+      VirtualMemory(page_allocator, kRegionSize, address_hint, kRegionSize);
+  if (!region->reservation.IsReserved()) return kNullAddress;
+  const Address base = region->reservation.address();
+  if (!region->reservation.SetPermissions(base, kRegionSize,
+                                          PageAllocator::kReadWrite)) {
+    region->reservation.Free();
+    return kNullAddress;
+  }
+  allocator_->UpdateAllocatedSpaceLimits(base, base + kRegionSize);
+  // This is only a hint; without huge pages the pool still avoids splitting
+  // the mapping on every page allocation.
+  USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(base), kRegionSize));
+  if (FLAG_trace_unmapper) {
+    PrintIsolate(allocator_->isolate_, "HugePagePool: new region %p\n",
+                 reinterpret_cast<void*>(base));
+  }
+
+  free_pages_ += kPagesPerRegion;
+  Region* raw_region = region.get();
+  regions_.emplace(base, std::move(region));
+  return AllocateFromRegion(base, raw_region);
+}
+
+Address MemoryAllocator::HugePagePool::AllocateFromRegion(Address base,
+                                                          Region* region) {
+  for (int i = 0; i < kPagesPerRegion; i++) {
+    const uint32_t bit = 1u << i;
+    if (region->used_pages & bit) continue;
+    region->used_pages |= bit;
+    free_pages_--;
+    return base + i * MemoryChunk::kPageSize;
+  }
+  return kNullAddress;
+}
+
+bool MemoryAllocator::HugePagePool::Free(Address page) {
+  base::MutexGuard guard(&mutex_);
+  auto it = regions_.find(RoundDown(page, kRegionSize));
+  if (it == regions_.end()) return false;
+  const int index =
+      static_cast<int>((page - it->first) / MemoryChunk::kPageSize);
+  const uint32_t bit = 1u << index;
+  DCHECK_NE(0u, it->second->used_pages & bit);
+  it->second->used_pages &= ~bit;
+  free_pages_++;
+  return true;
+}
+
+bool MemoryAllocator::HugePagePool::Contains(Address page) {
+  base::MutexGuard guard(&mutex_);
+  return regions_.find(RoundDown(page, kRegionSize)) != regions_.end();
+}
+
+void MemoryAllocator::HugePagePool::ReleaseFreeRegions() {
+  base::MutexGuard guard(&mutex_);
+  for (auto it = regions_.begin(); it != regions_.end();) {
+    if (it->second->used_pages != 0) {
+      ++it;
+      continue;
+    }
+    it->second->reservation.Free();
+    free_pages_ -= kPagesPerRegion;
+    it = regions_.erase(it);
+  }
+}
+
+size_t MemoryAllocator::HugePagePool::CommittedFreeMemory() {
+  base::MutexGuard guard(&mutex_);
+  return free_pages_ * MemoryChunk::kPageSize;
+}
+
+void MemoryAllocator::HugePagePool::TearDown() {
+  ReleaseFreeRegions();
+  DCHECK(regions_.empty());
+}
+
 bool MemoryAllocator::CommitMemory(VirtualMemory* reservation) {
   Address base = reservation->address();
   size_t size = reservation->size();
@@ -513,6 +613,10 @@ void MemoryAllocator::PerformFreeMemory(MemoryChunk* chunk) {
   chunk->ReleaseAllAllocatedMemory();
 
   VirtualMemory* reservation = chunk->reserved_memory();
+  if (!reservation->IsReserved() &&
+      huge_page_pool()->Free(chunk->address())) {
+    return;
+  }
   if (chunk->IsFlagSet(MemoryChunk::POOLED)) {
     UncommitMemory(reservation);
   } else {
@@ -530,7 +634,11 @@ void MemoryAllocator::Free(MemoryAllocator::FreeMode mode, MemoryChunk* chunk) {
     case kConcurrentlyAndPool:
       DCHECK_EQ(chunk->size(), static_cast<size_t>(MemoryChunk::kPageSize));
       DCHECK_EQ(chunk->executable(), NOT_EXECUTABLE);
-      chunk->SetFlag(MemoryChunk::POOLED);
+      // Pages of the huge page pool return to it instead.
+      if (chunk->reserved_memory()->IsReserved() ||
+          !huge_page_pool()->Contains(chunk->address())) {
+        chunk->SetFlag(MemoryChunk::POOLED);
+      }
       V8_FALLTHROUGH;
     case kConcurrently:
       PreFreeMemory(chunk);
@@ -551,7 +659,13 @@ Page* MemoryAllocator::AllocatePage(MemoryAllocator::AllocationMode alloc_mode,
                                     size_t size, Space* owner,
                                     Executability executable) {
   MemoryChunk* chunk = nullptr;
-  if (alloc_mode == kUsePool) {
+  if (FLAG_huge_page_pool && executable == NOT_EXECUTABLE &&
+      size == static_cast<size_t>(
+                  MemoryChunkLayout::AllocatableMemoryInMemoryChunk(
+                      owner->identity()))) {
+    chunk = AllocatePageFromHugePagePool(owner);
+  }
+  if (chunk == nullptr && alloc_mode == kUsePool) {
     DCHECK_EQ(size, static_cast<size_t>(
                         MemoryChunkLayout::AllocatableMemoryInMemoryChunk(
                             owner->identity())));
@@ -611,6 +725,28 @@ MemoryChunk* MemoryAllocator::AllocatePagePooled(Space* owner) {
   return chunk;
 }
 
+MemoryChunk* MemoryAllocator::AllocatePageFromHugePagePool(Space* owner) {
+  DCHECK_NE(CODE_SPACE, owner->identity());
+  const Address start = huge_page_pool()->Allocate();
+  if (start == kNullAddress) return nullptr;
+  const int size = MemoryChunk::kPageSize;
+  const Address area_start =
+      start +
+      MemoryChunkLayout::ObjectStartOffsetInMemoryChunk(owner->identity());
+  const Address area_end = start + size;
+  if (Heap::ShouldZapGarbage()) {
+    ZapBlock(start, size, kZapValue);
+  }
+  // The page does not own a reservation; its memory belongs to the pool.
+  BasicMemoryChunk* basic_chunk =
+      BasicMemoryChunk::Initialize(isolate_->heap(), start, size, area_start,
+                                   area_end, owner, VirtualMemory());
+  MemoryChunk* chunk =
+      MemoryChunk::Initialize(basic_chunk, isolate_->heap(), NOT_EXECUTABLE);
+  size_ += size;
+  return chunk;
+}
+
 void MemoryAllocator::ZapBlock(Address start, size_t size,
                                uintptr_t zap_value) {
   DCHECK(IsAligned(start, kTaggedSize));
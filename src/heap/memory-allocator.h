@@ -132,6 +132,55 @@ class MemoryAllocator {
     friend class MemoryAllocator;
   };
 
+  // HugePagePool backs regular data pages with kRegionSize-aligned regions
+  // that are committed as a whole and advised to use transparent huge pages.
+  // Keeping the whole region in one mapping with uniform permissions lets the
+  // OS use a single huge page (and TLB entry) for it. Freed pages stay
+  // committed for reuse; a region is only released once all its pages are
+  // free and memory has to be reduced.
+  class HugePagePool {
+   public:
+    static constexpr size_t kRegionSize = 2 * MB;
+    static constexpr int kPagesPerRegion =
+        static_cast<int>(kRegionSize / MemoryChunk::kPageSize);
+    STATIC_ASSERT(kPagesPerRegion >= 1);
+    STATIC_ASSERT(kPagesPerRegion <= 32);
+
+    explicit HugePagePool(MemoryAllocator* allocator)
+        : allocator_(allocator) {}
+
+    // Returns the start of a committed page of MemoryChunk::kPageSize, or
+    // kNullAddress if no region could be reserved.
+    Address Allocate();
+
+    // Returns {page} to its region. Returns false if {page} is not owned by
+    // the pool.
+    bool Free(Address page);
+
+    V8_EXPORT_PRIVATE bool Contains(Address page);
+
+    // Releases all regions without used pages.
+    void ReleaseFreeRegions();
+
+    // Committed memory of free pages in the pool.
+    V8_EXPORT_PRIVATE size_t CommittedFreeMemory();
+
+    void TearDown();
+
+   private:
+    struct Region {
+      VirtualMemory reservation;
+      uint32_t used_pages = 0;  // Bitmask of pages handed out.
+    };
+
+    Address AllocateFromRegion(Address base, Region* region);
+
+    MemoryAllocator* const allocator_;
+    base::Mutex mutex_;
+    std::unordered_map<Address, std::unique_ptr<Region>> regions_;
+    size_t free_pages_ = 0;
+  };
+
   enum AllocationMode {
     // Regular allocation path. Does not use pool.
     kRegular,
@@ -250,6 +299,8 @@ class MemoryAllocator {
 
   Unmapper* unmapper() { return &unmapper_; }
 
+  HugePagePool* huge_page_pool() { return &huge_page_pool_; }
+
   void UnregisterReadOnlyPage(ReadOnlyPage* page);
 
  private:
@@ -297,6 +348,9 @@ class MemoryAllocator {
   // Frees a pooled page. Only used on tear-down and last-resort GCs.
   void FreePooledChunk(MemoryChunk* chunk);
 
+  // Allocates a regular data page from the huge page pool.
+  MemoryChunk* AllocatePageFromHugePagePool(Space* owner);
+
   // Initializes pages in a chunk. Returns the first page address.
   // This function and GetChunkId() are provided for the mark-compact
   // collector to rebuild page headers in the from space, which is
@@ -375,6 +429,7 @@ class MemoryAllocator {
 
   VirtualMemory last_chunk_;
   Unmapper unmapper_;
+  HugePagePool huge_page_pool_;
 
 #ifdef DEBUG
   // Data structure to remember allocated executable memory chunks.
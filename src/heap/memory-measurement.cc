@@ -195,23 +195,48 @@ bool MemoryMeasurement::EnqueueRequest(
 }
 
 std::vector<Address> MemoryMeasurement::StartProcessing() {
-  if (received_.empty()) return {};
+  continuous_marking_contexts_.clear();
+  if (received_.empty() && !continuous_) return {};
   std::unordered_set<Address> unique_contexts;
-  DCHECK(processing_.empty());
-  processing_ = std::move(received_);
-  for (const auto& request : processing_) {
-    Handle<WeakFixedArray> contexts = request.contexts;
+  auto add_contexts = [](Handle<WeakFixedArray> contexts,
+                         std::unordered_set<Address>* result) {
     for (int i = 0; i < contexts->length(); i++) {
       HeapObject context;
       if (contexts->Get(i).GetHeapObject(&context)) {
-        unique_contexts.insert(context.ptr());
+        result->insert(context.ptr());
       }
     }
+  };
+  DCHECK(processing_.empty());
+  processing_ = std::move(received_);
+  for (const auto& request : processing_) {
+    add_contexts(request.contexts, &unique_contexts);
+  }
+  if (continuous_ && !continuous_contexts_.is_null()) {
+    add_contexts(continuous_contexts_, &continuous_marking_contexts_);
+    unique_contexts.insert(continuous_marking_contexts_.begin(),
+                           continuous_marking_contexts_.end());
   }
   return std::vector<Address>(unique_contexts.begin(), unique_contexts.end());
 }
 
 void MemoryMeasurement::FinishProcessing(const NativeContextStats& stats) {
+  if (!continuous_marking_contexts_.empty()) {
+    // The tracked array may have been refreshed while marking was in
+    // progress. Only contexts that had their own worklist got precise sizes.
+    if (continuous_ && !continuous_contexts_.is_null()) {
+      for (int i = 0; i < continuous_contexts_->length(); i++) {
+        HeapObject context;
+        if (continuous_contexts_->Get(i).GetHeapObject(&context) &&
+            continuous_marking_contexts_.count(context.ptr())) {
+          continuous_sizes_[i] = stats.Get(context.ptr());
+        }
+      }
+      continuous_shared_ = stats.Get(MarkingWorklists::kSharedContext);
+      ScheduleReportingTask();
+    }
+    continuous_marking_contexts_.clear();
+  }
   if (processing_.empty()) return;
 
   while (!processing_.empty()) {
@@ -327,6 +352,70 @@ void MemoryMeasurement::ReportResults() {
     isolate_->counters()->measure_memory_delay_ms()->AddSample(
         static_cast<int>(request.timer.Elapsed().InMilliseconds()));
   }
+  // Pick up contexts created since the last refresh so that the next full GC
+  // measures them as well.
+  if (continuous_) UpdateContinuousContexts();
+}
+
+void MemoryMeasurement::SetContinuousMode(bool enabled) {
+  if (continuous_ == enabled) return;
+  continuous_ = enabled;
+  if (enabled) {
+    UpdateContinuousContexts();
+  } else {
+    ClearContinuousContexts();
+  }
+}
+
+bool MemoryMeasurement::GetContinuousResult(NativeContext context,
+                                            size_t* size) const {
+  if (!continuous_ || continuous_contexts_.is_null()) return false;
+  for (int i = 0; i < continuous_contexts_->length(); i++) {
+    HeapObject tracked;
+    if (continuous_contexts_->Get(i).GetHeapObject(&tracked) &&
+        tracked == context) {
+      if (continuous_sizes_[i] == kNotMeasured) return false;
+      *size = continuous_sizes_[i];
+      return true;
+    }
+  }
+  return false;
+}
+
+void MemoryMeasurement::UpdateContinuousContexts() {
+  HandleScope handle_scope(isolate_);
+  std::vector<Handle<NativeContext>> contexts =
+      isolate_->heap()->FindAllNativeContexts();
+  int length = static_cast<int>(contexts.size());
+  // Allocate before reading raw addresses below, as allocation may move
+  // objects.
+  Handle<WeakFixedArray> weak_contexts =
+      isolate_->factory()->NewWeakFixedArray(length);
+  std::unordered_map<Address, size_t> old_sizes;
+  if (!continuous_contexts_.is_null()) {
+    for (int i = 0; i < continuous_contexts_->length(); i++) {
+      HeapObject context;
+      if (continuous_contexts_->Get(i).GetHeapObject(&context)) {
+        old_sizes.emplace(context.ptr(), continuous_sizes_[i]);
+      }
+    }
+  }
+  std::vector<size_t> sizes(length, kNotMeasured);
+  for (int i = 0; i < length; ++i) {
+    weak_contexts->Set(i, HeapObjectReference::Weak(*contexts[i]));
+    auto it = old_sizes.find(contexts[i]->ptr());
+    if (it != old_sizes.end()) sizes[i] = it->second;
+  }
+  ClearContinuousContexts();
+  continuous_contexts_ = isolate_->global_handles()->Create(*weak_contexts);
+  continuous_sizes_ = std::move(sizes);
+}
+
+void MemoryMeasurement::ClearContinuousContexts() {
+  if (continuous_contexts_.is_null()) return;
+  GlobalHandles::Destroy(continuous_contexts_.location());
+  continuous_contexts_ = Handle<WeakFixedArray>();
+  continuous_sizes_.clear();
 }
 
 std::unique_ptr<v8::MeasureMemoryDelegate> MemoryMeasurement::DefaultDelegate(
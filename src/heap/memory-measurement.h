@@ -7,6 +7,7 @@
 
 #include <list>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "include/v8-statistics.h"
 #include "src/base/platform/elapsed-timer.h"
@@ -32,6 +33,13 @@ class MemoryMeasurement {
   std::vector<Address> StartProcessing();
   void FinishProcessing(const NativeContextStats& stats);
 
+  // In continuous mode every full GC attributes live bytes to all native
+  // contexts of the isolate. The mode never triggers a GC on its own.
+  void SetContinuousMode(bool enabled);
+  // Returns false if the context has not been measured by a full GC yet.
+  bool GetContinuousResult(NativeContext context, size_t* size) const;
+  size_t continuous_shared_size() const { return continuous_shared_; }
+
   static std::unique_ptr<v8::MeasureMemoryDelegate> DefaultDelegate(
       Isolate* isolate, Handle<NativeContext> context,
       Handle<JSPromise> promise, v8::MeasureMemoryMode mode);
@@ -52,6 +60,10 @@ class MemoryMeasurement {
   void SetGCTaskPending(v8::MeasureMemoryExecution execution);
   void SetGCTaskDone(v8::MeasureMemoryExecution execution);
   int NextGCTaskDelayInSeconds();
+  void UpdateContinuousContexts();
+  void ClearContinuousContexts();
+
+  static constexpr size_t kNotMeasured = std::numeric_limits<size_t>::max();
 
   std::list<Request> received_;
   std::list<Request> processing_;
@@ -61,6 +73,14 @@ class MemoryMeasurement {
   bool delayed_gc_task_pending_ = false;
   bool eager_gc_task_pending_ = false;
   base::RandomNumberGenerator random_number_generator_;
+  bool continuous_ = false;
+  // Native contexts tracked by continuous mode. The array is refreshed after
+  // each full GC and the sizes are index-aligned with it.
+  Handle<WeakFixedArray> continuous_contexts_;
+  std::vector<size_t> continuous_sizes_;
+  size_t continuous_shared_ = 0;
+  // Contexts that got their own marking worklist in the ongoing full GC.
+  std::unordered_set<Address> continuous_marking_contexts_;
 };
 
 // Infers the native context for some of the heap objects.
@@ -6,12 +6,22 @@
 #define V8_HEAP_READ_ONLY_HEAP_INL_H_
 
 #include "src/execution/isolate-utils-inl.h"
+#include "src/flags/flags.h"
 #include "src/heap/read-only-heap.h"
+#include "src/init/isolate-allocator.h"
 #include "src/roots/roots-inl.h"
 
 namespace v8 {
 namespace internal {
 
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+// static
+SoleReadOnlyHeap* SoleReadOnlyHeap::ForCage(Address cage_base) {
+  int index = IsolateAllocator::GetSharedPtrComprCageIndex(cage_base);
+  return index < 0 ? nullptr : per_cage_ro_heaps_[index];
+}
+#endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+
 // static
 ReadOnlyRoots ReadOnlyHeap::GetReadOnlyRoots(HeapObject object) {
 #ifdef V8_COMPRESS_POINTERS_IN_ISOLATE_CAGE
@@ -22,6 +32,13 @@ ReadOnlyRoots ReadOnlyHeap::GetReadOnlyRoots(HeapObject object) {
   // This fails if we are creating heap objects and the roots haven't yet been
   // copied into the read-only heap.
   auto* shared_ro_heap = SoleReadOnlyHeap::shared_ro_heap_;
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  // With a single cage, shared_ro_heap_ is the heap of that cage.
+  if (V8_UNLIKELY(FLAG_shared_ptr_compr_cages > 1)) {
+    shared_ro_heap =
+        SoleReadOnlyHeap::ForCage(GetPtrComprCageBaseAddress(object.ptr()));
+  }
+#endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
   if (shared_ro_heap != nullptr && shared_ro_heap->init_complete_) {
     return ReadOnlyRoots(shared_ro_heap->read_only_roots_);
   }
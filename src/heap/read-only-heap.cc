@@ -4,6 +4,7 @@
 
 #include "src/heap/read-only-heap.h"
 
+#include <array>
 #include <cstddef>
 #include <cstring>
 
@@ -15,6 +16,7 @@
 #include "src/heap/memory-chunk.h"
 #include "src/heap/read-only-spaces.h"
 #include "src/heap/third-party/heap-api.h"
+#include "src/init/isolate-allocator.h"
 #include "src/objects/heap-object-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/smi.h"
@@ -28,21 +30,45 @@ namespace {
 // Mutex used to ensure that ReadOnlyArtifacts creation is only done once.
 base::LazyMutex read_only_heap_creation_mutex_ = LAZY_MUTEX_INITIALIZER;
 
-// Weak pointer holding ReadOnlyArtifacts. ReadOnlyHeap::SetUp creates a
-// std::shared_ptr from this when it attempts to reuse it. Since all Isolates
-// hold a std::shared_ptr to this, the object is destroyed when no Isolates
-// remain.
-base::LazyInstance<std::weak_ptr<ReadOnlyArtifacts>>::type
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+constexpr int kReadOnlyArtifactsCount = kMaxSharedPtrComprCages;
+#else
+constexpr int kReadOnlyArtifactsCount = 1;
+#endif
+
+// Weak pointers holding ReadOnlyArtifacts, one per shared pointer compression
+// cage. ReadOnlyHeap::SetUp creates a std::shared_ptr from this when it
+// attempts to reuse it. Since all Isolates hold a std::shared_ptr to this, the
+// object is destroyed when no Isolates remain.
+base::LazyInstance<std::array<std::weak_ptr<ReadOnlyArtifacts>,
+                              kReadOnlyArtifactsCount>>::type
     read_only_artifacts_ = LAZY_INSTANCE_INITIALIZER;
 
-std::shared_ptr<ReadOnlyArtifacts> InitializeSharedReadOnlyArtifacts() {
+// Each shared pointer compression cage has its own copy of the read-only heap.
+int ReadOnlyArtifactsIndex(Isolate* isolate) {
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  int index =
+      IsolateAllocator::GetSharedPtrComprCageIndex(isolate->cage_base());
+  DCHECK_LE(0, index);
+  return index;
+#else
+  return 0;
+#endif
+}
+
+std::weak_ptr<ReadOnlyArtifacts>& ReadOnlyArtifactsFor(Isolate* isolate) {
+  return (*read_only_artifacts_.Pointer())[ReadOnlyArtifactsIndex(isolate)];
+}
+
+std::shared_ptr<ReadOnlyArtifacts> InitializeSharedReadOnlyArtifacts(
+    Isolate* isolate) {
   std::shared_ptr<ReadOnlyArtifacts> artifacts;
   if (COMPRESS_POINTERS_IN_ISOLATE_CAGE_BOOL) {
     artifacts = std::make_shared<PointerCompressedReadOnlyArtifacts>();
   } else {
     artifacts = std::make_shared<SingleCopyReadOnlyArtifacts>();
   }
-  *read_only_artifacts_.Pointer() = artifacts;
+  ReadOnlyArtifactsFor(isolate) = artifacts;
   return artifacts;
 }
 }  // namespace
@@ -59,6 +85,10 @@ bool ReadOnlyHeap::IsSharedMemoryAvailable() {
 // read_only_artifacts_.
 SoleReadOnlyHeap* SoleReadOnlyHeap::shared_ro_heap_ = nullptr;
 
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+SoleReadOnlyHeap* SoleReadOnlyHeap::per_cage_ro_heaps_[kMaxSharedPtrComprCages];
+#endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+
 // static
 void ReadOnlyHeap::SetUp(Isolate* isolate,
                          SnapshotData* read_only_snapshot_data,
@@ -71,9 +101,9 @@ void ReadOnlyHeap::SetUp(Isolate* isolate,
       bool read_only_heap_created = false;
       base::MutexGuard guard(read_only_heap_creation_mutex_.Pointer());
       std::shared_ptr<ReadOnlyArtifacts> artifacts =
-          read_only_artifacts_.Get().lock();
+          ReadOnlyArtifactsFor(isolate).lock();
       if (!artifacts) {
-        artifacts = InitializeSharedReadOnlyArtifacts();
+        artifacts = InitializeSharedReadOnlyArtifacts(isolate);
         artifacts->InitializeChecksum(read_only_snapshot_data);
         ro_heap = CreateInitalHeapForBootstrapping(isolate, artifacts);
         ro_heap->DeseralizeIntoIsolate(isolate, read_only_snapshot_data,
@@ -93,9 +123,9 @@ void ReadOnlyHeap::SetUp(Isolate* isolate,
       // before tearing down the Isolate that holds this ReadOnlyArtifacts and
       // is not thread-safe.
       std::shared_ptr<ReadOnlyArtifacts> artifacts =
-          read_only_artifacts_.Get().lock();
+          ReadOnlyArtifactsFor(isolate).lock();
       CHECK(!artifacts);
-      artifacts = InitializeSharedReadOnlyArtifacts();
+      artifacts = InitializeSharedReadOnlyArtifacts(isolate);
 
       ro_heap = CreateInitalHeapForBootstrapping(isolate, artifacts);
       artifacts->VerifyChecksum(read_only_snapshot_data, true);
@@ -144,8 +174,17 @@ ReadOnlyHeap* ReadOnlyHeap::CreateInitalHeapForBootstrapping(
   } else {
     std::unique_ptr<SoleReadOnlyHeap> sole_ro_heap(
         new SoleReadOnlyHeap(ro_space));
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+    // With several shared cages the ReadOnlyHeap is looked up by cage. The
+    // first cage also provides the global one, which is all that is used
+    // when there is only a single cage.
+    int index = ReadOnlyArtifactsIndex(isolate);
+    SoleReadOnlyHeap::per_cage_ro_heaps_[index] = sole_ro_heap.get();
+    if (index == 0) SoleReadOnlyHeap::shared_ro_heap_ = sole_ro_heap.get();
+#else
     // The global shared ReadOnlyHeap is only used without pointer compression.
     SoleReadOnlyHeap::shared_ro_heap_ = sole_ro_heap.get();
+#endif
     ro_heap = std::move(sole_ro_heap);
   }
   artifacts->set_read_only_heap(std::move(ro_heap));
@@ -173,7 +212,7 @@ void ReadOnlyHeap::InitFromIsolate(Isolate* isolate) {
   if (IsReadOnlySpaceShared()) {
     InitializeFromIsolateRoots(isolate);
     std::shared_ptr<ReadOnlyArtifacts> artifacts(
-        *read_only_artifacts_.Pointer());
+        ReadOnlyArtifactsFor(isolate));
 
     read_only_space()->DetachPagesAndAddToArtifacts(artifacts);
     artifacts->ReinstallReadOnlySpace(isolate);
@@ -205,13 +244,14 @@ void ReadOnlyHeap::PopulateReadOnlySpaceStatistics(
   statistics->read_only_space_used_size_ = 0;
   statistics->read_only_space_physical_size_ = 0;
   if (IsReadOnlySpaceShared()) {
-    std::shared_ptr<ReadOnlyArtifacts> artifacts =
-        read_only_artifacts_.Get().lock();
-    if (artifacts) {
+    // Sums up the copies of all shared pointer compression cages.
+    for (const auto& weak_artifacts : read_only_artifacts_.Get()) {
+      std::shared_ptr<ReadOnlyArtifacts> artifacts = weak_artifacts.lock();
+      if (!artifacts) continue;
       auto* ro_space = artifacts->shared_read_only_space();
-      statistics->read_only_space_size_ = ro_space->CommittedMemory();
-      statistics->read_only_space_used_size_ = ro_space->Size();
-      statistics->read_only_space_physical_size_ =
+      statistics->read_only_space_size_ += ro_space->CommittedMemory();
+      statistics->read_only_space_used_size_ += ro_space->Size();
+      statistics->read_only_space_physical_size_ +=
           ro_space->CommittedPhysicalMemory();
     }
   }
@@ -11,6 +11,7 @@
 
 #include "src/base/macros.h"
 #include "src/base/optional.h"
+#include "src/common/ptr-compr.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/objects.h"
 #include "src/roots/roots.h"
@@ -142,6 +143,13 @@ class SoleReadOnlyHeap : public ReadOnlyHeap {
   explicit SoleReadOnlyHeap(ReadOnlySpace* ro_space) : ReadOnlyHeap(ro_space) {}
   Address read_only_roots_[kEntriesCount];
   V8_EXPORT_PRIVATE static SoleReadOnlyHeap* shared_ro_heap_;
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  // Returns the ReadOnlyHeap of the shared cage with the given base. Used
+  // instead of shared_ro_heap_ with more than one shared cage.
+  static inline SoleReadOnlyHeap* ForCage(Address cage_base);
+  V8_EXPORT_PRIVATE static SoleReadOnlyHeap*
+      per_cage_ro_heaps_[kMaxSharedPtrComprCages];
+#endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
 };
 
 // This class enables iterating over all read-only heap objects.
@@ -7,6 +7,8 @@
 #include "src/handles/global-handles.h"
 #include "src/heap/array-buffer-sweeper.h"
 #include "src/heap/barrier.h"
+#include "src/heap/cppgc-js/cpp-heap.h"
+#include "src/heap/embedder-tracing-inl.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/invalidated-slots-inl.h"
@@ -453,6 +455,15 @@ void ScavengerCollector::CollectGarbage() {
     SweepArrayBufferExtensions();
   }
 
+  if (V8_UNLIKELY(FLAG_cppgc_young_generation) && heap_->cpp_heap()) {
+    TRACE_GC(heap_->tracer(), GCTracer::Scope::SCAVENGER_CPP_HEAP);
+    CppHeap::From(heap_->cpp_heap())
+        ->CollectYoungGeneration(young_cpp_wrappables_,
+                                 promoted_cpp_wrappables_);
+  }
+  young_cpp_wrappables_.clear();
+  promoted_cpp_wrappables_.clear();
+
   // Update how much has survived scavenge.
   heap_->IncrementYoungSurvivorsCounter(heap_->SurvivedYoungObjectSize());
 }
@@ -519,6 +530,17 @@ void ScavengerCollector::MergeSurvivingNewLargeObjects(
   }
 }
 
+void ScavengerCollector::MergeCppWrappables(
+    const std::vector<void*>& young_wrappables,
+    const std::vector<void*>& promoted_wrappables) {
+  young_cpp_wrappables_.insert(young_cpp_wrappables_.end(),
+                               young_wrappables.begin(),
+                               young_wrappables.end());
+  promoted_cpp_wrappables_.insert(promoted_cpp_wrappables_.end(),
+                                  promoted_wrappables.begin(),
+                                  promoted_wrappables.end());
+}
+
 int ScavengerCollector::NumberOfScavengeTasks() {
   if (!FLAG_parallel_scavenge) return 1;
   const int num_scavenge_tasks =
@@ -555,12 +577,36 @@ Scavenger::Scavenger(ScavengerCollector* collector, Heap* heap, bool is_logging,
       promoted_size_(0),
       allocator_(heap, CompactionSpaceKind::kCompactionSpaceForScavenge),
       shared_old_allocator_(heap_->shared_old_allocator_.get()),
+      cpp_heap_(FLAG_cppgc_young_generation && heap->cpp_heap()
+                    ? CppHeap::From(heap->cpp_heap())
+                    : nullptr),
       is_logging_(is_logging),
       is_incremental_marking_(heap->incremental_marking()->IsMarking()),
       is_compacting_(heap->incremental_marking()->IsCompacting()),
       shared_string_table_(FLAG_shared_string_table &&
                            (heap->isolate()->shared_isolate() != nullptr)) {}
 
+void Scavenger::RecordCppWrappableIfNeeded(HeapObject object,
+                                           std::vector<void*>* wrappables) {
+  DCHECK_NOT_NULL(cpp_heap_);
+  // Same as the embedder tracing subclasses in MarkingVisitorBase.
+  switch (object.map().visitor_id()) {
+    case kVisitJSApiObject:
+    case kVisitJSArrayBuffer:
+    case kVisitJSDataView:
+    case kVisitJSTypedArray:
+      break;
+    default:
+      return;
+  }
+  LocalEmbedderHeapTracer::WrapperInfo info;
+  if (LocalEmbedderHeapTracer::ExtractWrappableInfo(
+          heap()->isolate(), JSObject::cast(object),
+          cpp_heap_->wrapper_descriptor(), &info)) {
+    wrappables->push_back(info.second);
+  }
+}
+
 void Scavenger::IterateAndScavengePromotedObject(HeapObject target, Map map,
                                                  int size) {
   // We are not collecting slots on new space objects during mutation thus we
@@ -650,6 +696,10 @@ void Scavenger::Process(JobDelegate* delegate) {
     while (promotion_list_local_.ShouldEagerlyProcessPromotionList() &&
            copied_list_local_.Pop(&object_and_size)) {
       scavenge_visitor.Visit(object_and_size.first);
+      if (V8_UNLIKELY(cpp_heap_)) {
+        RecordCppWrappableIfNeeded(object_and_size.first,
+                                   &young_cpp_wrappables_);
+      }
       done = false;
       if (delegate && ((++objects % kInterruptThreshold) == 0)) {
         if (!copied_list_local_.IsEmpty()) {
@@ -662,6 +712,9 @@ void Scavenger::Process(JobDelegate* delegate) {
     while (promotion_list_local_.Pop(&entry)) {
       HeapObject target = entry.heap_object;
       IterateAndScavengePromotedObject(target, entry.map, entry.size);
+      if (V8_UNLIKELY(cpp_heap_)) {
+        RecordCppWrappableIfNeeded(target, &promoted_cpp_wrappables_);
+      }
       done = false;
       if (delegate && ((++objects % kInterruptThreshold) == 0)) {
         if (!promotion_list_local_.IsGlobalPoolEmpty()) {
@@ -740,6 +793,10 @@ void Scavenger::Finalize() {
   heap()->IncrementSemiSpaceCopiedObjectSize(copied_size_);
   heap()->IncrementPromotedObjectsSize(promoted_size_);
   collector_->MergeSurvivingNewLargeObjects(surviving_new_large_objects_);
+  if (cpp_heap_) {
+    collector_->MergeCppWrappables(young_cpp_wrappables_,
+                                   promoted_cpp_wrappables_);
+  }
   allocator_.Finalize();
   empty_chunks_local_.Publish();
   ephemeron_table_list_local_.Publish();
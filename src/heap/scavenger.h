@@ -16,6 +16,7 @@
 namespace v8 {
 namespace internal {
 
+class CppHeap;
 class OneshotBarrier;
 class RootScavengeVisitor;
 class Scavenger;
@@ -187,6 +188,10 @@ class Scavenger {
   void IterateAndScavengePromotedObject(HeapObject target, Map map, int size);
   void RememberPromotedEphemeron(EphemeronHashTable table, int index);
 
+  // Records the C++ object held by {object} if it is a wrapper.
+  void RecordCppWrappableIfNeeded(HeapObject object,
+                                  std::vector<void*>* wrappables);
+
   ScavengerCollector* const collector_;
   Heap* const heap_;
   EmptyChunksList::Local empty_chunks_local_;
@@ -199,6 +204,10 @@ class Scavenger {
   EvacuationAllocator allocator_;
   ConcurrentAllocator* shared_old_allocator_ = nullptr;
   SurvivingNewLargeObjectsMap surviving_new_large_objects_;
+  // Only set with --cppgc-young-generation.
+  CppHeap* const cpp_heap_;
+  std::vector<void*> young_cpp_wrappables_;
+  std::vector<void*> promoted_cpp_wrappables_;
 
   EphemeronRememberedSet ephemeron_remembered_set_;
   const bool is_logging_;
@@ -293,6 +302,8 @@ class ScavengerCollector {
 
   void MergeSurvivingNewLargeObjects(
       const SurvivingNewLargeObjectsMap& objects);
+  void MergeCppWrappables(const std::vector<void*>& young_wrappables,
+                          const std::vector<void*>& promoted_wrappables);
 
   int NumberOfScavengeTasks();
 
@@ -310,6 +321,8 @@ class ScavengerCollector {
   Isolate* const isolate_;
   Heap* const heap_;
   SurvivingNewLargeObjectsMap surviving_new_large_objects_;
+  std::vector<void*> young_cpp_wrappables_;
+  std::vector<void*> promoted_cpp_wrappables_;
 
   friend class Scavenger;
 };
@@ -61,19 +61,155 @@ namespace {
 DEFINE_LAZY_LEAKY_OBJECT_GETTER(VirtualMemoryCage, GetProcessWidePtrComprCage)
 }  // anonymous namespace
 
+// Keeps track of the process-wide cages and of how many Isolates live in
+// each of them. The first cage is reserved in InitializeOncePerProcess(), the
+// others are reserved when the first Isolate is assigned to them and stay
+// reserved for the rest of the process. A cage that cannot be reserved is not
+// retried, and its Isolates go to the cages that are already reserved.
+class SharedPtrComprCages final {
+ public:
+  VirtualMemoryCage* Get(int index) {
+    DCHECK_LE(0, index);
+    DCHECK_LT(index, kMaxSharedPtrComprCages);
+    return index == 0 ? GetProcessWidePtrComprCage()
+                      : &additional_cages_[index - 1];
+  }
+
+  void SetFirstCage() {
+    VirtualMemoryCage* cage = GetProcessWidePtrComprCage();
+    CHECK(IsolateAllocator::SetSharedPtrComprCageIndex(cage->base(), 0));
+  }
+
+  // Assigns an Isolate to the cage with the fewest Isolates. While there are
+  // shared Isolates, all Isolates are assigned to their cage, as Isolates
+  // can only attach to a shared Isolate in the same cage.
+  int Acquire(bool is_shared) {
+    base::MutexGuard guard(&mutex_);
+    int index = shared_isolate_cage_index_;
+    if (shared_isolate_count_ == 0) {
+      const int cage_count = std::max(
+          1, std::min(FLAG_shared_ptr_compr_cages, kMaxSharedPtrComprCages));
+      index = LeastLoaded(cage_count, false);
+      if (!Get(index)->IsReserved() && !Reserve(index)) {
+        index = LeastLoaded(cage_count, true);
+      }
+    }
+    DCHECK(Get(index)->IsReserved());
+    if (is_shared) {
+      shared_isolate_cage_index_ = index;
+      shared_isolate_count_++;
+    }
+    isolate_counts_[index]++;
+    return index;
+  }
+
+  void Release(int index, bool is_shared) {
+    base::MutexGuard guard(&mutex_);
+    DCHECK_LT(0, isolate_counts_[index]);
+    isolate_counts_[index]--;
+    if (is_shared) {
+      DCHECK_EQ(shared_isolate_cage_index_, index);
+      DCHECK_LT(0, shared_isolate_count_);
+      shared_isolate_count_--;
+    }
+  }
+
+  void set_reservation_fails_for_testing(bool fails) {
+    base::MutexGuard guard(&mutex_);
+    reservation_fails_for_testing_ = fails;
+  }
+
+  void FreeForTesting() {
+    for (int i = 0; i < kMaxSharedPtrComprCages; i++) {
+      VirtualMemoryCage* cage = Get(i);
+      if (!cage->IsReserved()) continue;
+      if (std::shared_ptr<CodeRange> code_range =
+              CodeRange::GetProcessWideCodeRange(cage->base())) {
+        code_range->Free();
+      }
+      IsolateAllocator::SetSharedPtrComprCageIndex(cage->base(), -1);
+      cage->Free();
+    }
+  }
+
+ private:
+  // Returns the cage with the fewest Isolates among the first |cage_count|
+  // cages, optionally only among the ones that are already reserved.
+  int LeastLoaded(int cage_count, bool reserved_only) {
+    int index = 0;
+    for (int i = 1; i < cage_count; i++) {
+      if (unavailable_[i] || (reserved_only && !Get(i)->IsReserved())) {
+        continue;
+      }
+      if (isolate_counts_[i] < isolate_counts_[index]) index = i;
+    }
+    return index;
+  }
+
+  bool Reserve(int index) {
+    DCHECK_NE(0, index);
+    VirtualMemoryCage* cage = Get(index);
+    if (reservation_fails_for_testing_) return false;
+    PtrComprCageReservationParams params;
+    if (!cage->InitReservation(params)) {
+      unavailable_[index] = true;
+      return false;
+    }
+    if (!IsolateAllocator::SetSharedPtrComprCageIndex(cage->base(), index)) {
+      // The cage is out of the range of addresses that can be looked up.
+      cage->Free();
+      unavailable_[index] = true;
+      return false;
+    }
+    return true;
+  }
+
+  base::Mutex mutex_;
+  VirtualMemoryCage additional_cages_[kMaxSharedPtrComprCages - 1];
+  int isolate_counts_[kMaxSharedPtrComprCages] = {};
+  bool unavailable_[kMaxSharedPtrComprCages] = {};
+  int shared_isolate_cage_index_ = 0;
+  int shared_isolate_count_ = 0;
+  bool reservation_fails_for_testing_ = false;
+};
+
+namespace {
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(SharedPtrComprCages, GetSharedPtrComprCages)
+}  // anonymous namespace
+
+// static
+std::atomic<int8_t> IsolateAllocator::shared_ptr_compr_cage_indices_
+    [kSharedPtrComprCageIndexTableSize];
+
+// static
+bool IsolateAllocator::SetSharedPtrComprCageIndex(Address cage_base,
+                                                  int index) {
+  DCHECK(IsAligned(cage_base, kPtrComprCageBaseAlignment));
+  const size_t slot = cage_base >> kPtrComprCageBaseAlignmentLog2;
+  if (slot >= kSharedPtrComprCageIndexTableSize) return false;
+  shared_ptr_compr_cage_indices_[slot].store(static_cast<int8_t>(index + 1),
+                                             std::memory_order_release);
+  return true;
+}
+
 // static
 void IsolateAllocator::FreeProcessWidePtrComprCageForTesting() {
-  if (std::shared_ptr<CodeRange> code_range =
-          CodeRange::GetProcessWideCodeRange()) {
-    code_range->Free();
-  }
-  GetProcessWidePtrComprCage()->Free();
+  GetSharedPtrComprCages()->FreeForTesting();
+}
+
+// static
+void IsolateAllocator::SetSharedPtrComprCageReservationFailsForTesting(
+    bool fails) {
+  GetSharedPtrComprCages()->set_reservation_fails_for_testing(fails);
 }
 #endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
 
 // static
 void IsolateAllocator::InitializeOncePerProcess() {
 #ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  FLAG_shared_ptr_compr_cages =
+      std::max(1, std::min(FLAG_shared_ptr_compr_cages,
+                           kMaxSharedPtrComprCages));
   PtrComprCageReservationParams params;
   base::AddressRegion existing_reservation;
 #ifdef V8_SANDBOX
@@ -101,6 +237,8 @@ void IsolateAllocator::InitializeOncePerProcess() {
     existing_reservation =
         base::AddressRegion(cage->base(), params.reservation_size);
     params.page_allocator = cage->page_allocator();
+    // Only one pointer compression cage fits at the start of the sandbox.
+    FLAG_shared_ptr_compr_cages = 1;
   }
 #endif
   if (!GetProcessWidePtrComprCage()->InitReservation(params,
@@ -110,10 +248,11 @@ void IsolateAllocator::InitializeOncePerProcess() {
         "Failed to reserve virtual memory for process-wide V8 "
         "pointer compression cage");
   }
+  GetSharedPtrComprCages()->SetFirstCage();
 #endif
 }
 
-IsolateAllocator::IsolateAllocator() {
+IsolateAllocator::IsolateAllocator(bool is_shared) {
 #if defined(V8_COMPRESS_POINTERS_IN_ISOLATE_CAGE)
   PtrComprCageReservationParams params;
   if (!isolate_ptr_compr_cage_.InitReservation(params)) {
@@ -126,7 +265,9 @@ IsolateAllocator::IsolateAllocator() {
 #elif defined(V8_COMPRESS_POINTERS_IN_SHARED_CAGE)
   // Allocate Isolate in C++ heap when sharing a cage.
   CHECK(GetProcessWidePtrComprCage()->IsReserved());
-  page_allocator_ = GetProcessWidePtrComprCage()->page_allocator();
+  is_shared_ = is_shared;
+  shared_ptr_compr_cage_index_ = GetSharedPtrComprCages()->Acquire(is_shared);
+  page_allocator_ = GetPtrComprCage()->page_allocator();
   isolate_memory_ = ::operator new(sizeof(Isolate));
 #else
   // Allocate Isolate in C++ heap.
@@ -145,6 +286,9 @@ IsolateAllocator::~IsolateAllocator() {
     return;
   }
 #endif
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  GetSharedPtrComprCages()->Release(shared_ptr_compr_cage_index_, is_shared_);
+#endif
 
   // The memory was allocated in C++ heap.
   ::operator delete(isolate_memory_);
@@ -154,7 +298,7 @@ VirtualMemoryCage* IsolateAllocator::GetPtrComprCage() {
 #if defined V8_COMPRESS_POINTERS_IN_ISOLATE_CAGE
   return &isolate_ptr_compr_cage_;
 #elif defined V8_COMPRESS_POINTERS_IN_SHARED_CAGE
-  return GetProcessWidePtrComprCage();
+  return GetSharedPtrComprCages()->Get(shared_ptr_compr_cage_index_);
 #else
   return nullptr;
 #endif
@@ -5,10 +5,12 @@
 #ifndef V8_INIT_ISOLATE_ALLOCATOR_H_
 #define V8_INIT_ISOLATE_ALLOCATOR_H_
 
+#include <atomic>
 #include <memory>
 
 #include "src/base/page-allocator.h"
 #include "src/common/globals.h"
+#include "src/common/ptr-compr.h"
 #include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 
@@ -22,6 +24,12 @@ namespace internal {
 // 1) in the C++ heap (when pointer compression is disabled or when multiple
 // Isolates share a pointer compression cage)
 //
+// With a shared cage and --shared-ptr-compr-cages > 1, Isolates are
+// distributed over several process-wide cages so that the total heap of all
+// Isolates can exceed 4Gb. Each cage gets its own read-only heap and
+// CodeRange. While a shared Isolate exists, all Isolates are placed into its
+// cage so that they can attach to it.
+//
 // 2) in a proper part of a properly aligned region of a reserved address space
 //   (when pointer compression is enabled and each Isolate has its own pointer
 //   compression cage).
@@ -33,7 +41,9 @@ namespace internal {
 // Isolate::Delete() takes care of the proper order of the objects destruction.
 class V8_EXPORT_PRIVATE IsolateAllocator final {
  public:
-  IsolateAllocator();
+  // |is_shared| is set for the memory of a shared Isolate, whose cage all
+  // other Isolates are assigned to while it lives.
+  explicit IsolateAllocator(bool is_shared = false);
   ~IsolateAllocator();
   IsolateAllocator(const IsolateAllocator&) = delete;
   IsolateAllocator& operator=(const IsolateAllocator&) = delete;
@@ -53,6 +63,28 @@ class V8_EXPORT_PRIVATE IsolateAllocator final {
 
   static void InitializeOncePerProcess();
 
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  // Index of the process-wide cage this Isolate lives in.
+  int shared_ptr_compr_cage_index() const {
+    return shared_ptr_compr_cage_index_;
+  }
+
+  // Returns the index of the process-wide cage with the given base or -1 if
+  // there is no such cage. This is a single table lookup, as it is used for
+  // finding the read-only roots of an object.
+  static int GetSharedPtrComprCageIndex(Address cage_base) {
+    const size_t slot = cage_base >> kPtrComprCageBaseAlignmentLog2;
+    if (slot >= kSharedPtrComprCageIndexTableSize) return -1;
+    return shared_ptr_compr_cage_indices_[slot].load(
+               std::memory_order_acquire) -
+           1;
+  }
+
+  // Makes reservations of additional cages fail, so that Isolates fall back
+  // to the cages that are already reserved.
+  static void SetSharedPtrComprCageReservationFailsForTesting(bool fails);
+#endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+
  private:
   void CommitPagesForIsolate();
 
@@ -60,12 +92,29 @@ class V8_EXPORT_PRIVATE IsolateAllocator final {
   // Only used for testing.
   static void FreeProcessWidePtrComprCageForTesting();
 
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  friend class SharedPtrComprCages;
+
+  // Records |index| for the cage at |cage_base|. Returns false if the cage
+  // is out of the range of the lookup table.
+  static bool SetSharedPtrComprCageIndex(Address cage_base, int index);
+
+  // Index + 1 of the process-wide cage for each 4GB-aligned address, 0 for
+  // addresses without a cage.
+  static std::atomic<int8_t>
+      shared_ptr_compr_cage_indices_[kSharedPtrComprCageIndexTableSize];
+#endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+
   // The allocated memory for Isolate instance.
   void* isolate_memory_ = nullptr;
   v8::PageAllocator* page_allocator_ = nullptr;
 #ifdef V8_COMPRESS_POINTERS_IN_ISOLATE_CAGE
   VirtualMemoryCage isolate_ptr_compr_cage_;
 #endif
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  int shared_ptr_compr_cage_index_ = 0;
+  bool is_shared_ = false;
+#endif
 };
 
 }  // namespace internal
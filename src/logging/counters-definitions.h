@@ -222,6 +222,8 @@ namespace internal {
      1000000, MICROSECOND)                                                     \
   HT(wasm_compile_huge_function_time, V8.WasmCompileHugeFunctionMilliSeconds,  \
      100000, MILLISECOND)                                                      \
+  HT(wasm_validate_wasm_function_time,                                         \
+     V8.WasmValidateFunctionMicroSeconds.wasm, 1000000, MICROSECOND)           \
   HT(wasm_instantiate_wasm_module_time,                                        \
      V8.WasmInstantiateModuleMicroSeconds.wasm, 10000000, MICROSECOND)         \
   HT(wasm_instantiate_asm_module_time,                                         \
@@ -165,11 +165,12 @@ inline EmbeddedData EmbeddedDataWithMaybeRemappedEmbeddedBuiltins(Code code) {
   return EmbeddedData::FromBlob(GetIsolateFromWritableObject(code));
 #elif defined(V8_COMPRESS_POINTERS_IN_SHARED_CAGE)
   // When pointer compression is enabled with a shared cage, there is also a
-  // shared CodeRange. When short builtin calls are enabled, there is a single
-  // copy of the re-embedded builtins in the shared CodeRange, so use that if
-  // it's present.
+  // shared CodeRange per cage. When short builtin calls are enabled, there is
+  // a single copy of the re-embedded builtins in the shared CodeRange of the
+  // code's cage, so use that if it's present.
   if (FLAG_jitless) return EmbeddedData::FromBlob();
-  CodeRange* code_range = CodeRange::GetProcessWideCodeRange().get();
+  Address cage_base = GetPtrComprCageBaseAddress(code.ptr());
+  CodeRange* code_range = CodeRange::GetProcessWideCodeRange(cage_base).get();
   return (code_range && code_range->embedded_blob_code_copy() != nullptr)
              ? EmbeddedData::FromBlob(code_range)
              : EmbeddedData::FromBlob();
@@ -201,11 +201,13 @@ void OffHeapCompressedObjectSlot::Release_Store(Object value) const {
   AsAtomicTagged::Release_Store(location(), ptr);
 }
 
-void OffHeapCompressedObjectSlot::Release_CompareAndSwap(Object old,
-                                                         Object target) const {
+Object OffHeapCompressedObjectSlot::Release_CompareAndSwap(
+    PtrComprCageBase cage_base, Object old, Object target) const {
   Tagged_t old_ptr = CompressTagged(old.ptr());
   Tagged_t target_ptr = CompressTagged(target.ptr());
-  AsAtomicTagged::Release_CompareAndSwap(location(), old_ptr, target_ptr);
+  Tagged_t result =
+      AsAtomicTagged::Release_CompareAndSwap(location(), old_ptr, target_ptr);
+  return Object(DecompressTaggedAny(cage_base, result));
 }
 
 }  // namespace internal
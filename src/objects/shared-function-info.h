@@ -448,6 +448,13 @@ class SharedFunctionInfo
   DECL_BOOLEAN_ACCESSORS(class_scope_has_private_brand)
   DECL_BOOLEAN_ACCESSORS(has_static_private_methods_or_accessors)
 
+  // Indicates that this function got hot in this or (via the code cache or
+  // the snapshot) in a previous run, i.e. TurboFan code has been generated
+  // for it or it collected enough profiler ticks for it while warming up a
+  // snapshot. Cleared when the function's optimized code deoptimizes. Only
+  // maintained with --code-cache-tiering-hints or --snapshot-tiering-hints.
+  DECL_BOOLEAN_ACCESSORS(is_known_hot)
+
   // Is this function a top-level function (scripts, evals).
   DECL_BOOLEAN_ACCESSORS(is_toplevel)
 
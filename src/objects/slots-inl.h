@@ -92,6 +92,16 @@ Object FullObjectSlot::Release_CompareAndSwap(Object old, Object target) const {
   return Object(result);
 }
 
+//
+// OffHeapFullObjectSlot implementation.
+//
+
+Object OffHeapFullObjectSlot::Release_CompareAndSwap(PtrComprCageBase cage_base,
+                                                     Object old,
+                                                     Object target) const {
+  return FullObjectSlot::Release_CompareAndSwap(old, target);
+}
+
 //
 // FullMaybeObjectSlot implementation.
 //
@@ -276,6 +276,9 @@ class OffHeapFullObjectSlot : public FullObjectSlot {
 
   using FullObjectSlot::Relaxed_Load;
   inline Object Relaxed_Load() const = delete;
+
+  inline Object Release_CompareAndSwap(PtrComprCageBase cage_base, Object old,
+                                       Object target) const;
 };
 
 }  // namespace internal
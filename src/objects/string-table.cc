@@ -88,6 +88,13 @@ bool KeyIsMatch(IsolateT* isolate, StringTableKey* key, String string) {
 // The elements themselves are stored as an open-addressed hash table, with
 // quadratic probing and Smi 0 and Smi 1 as the empty and deleted sentinels,
 // respectively.
+//
+// New elements are inserted with a compare-and-swap on the empty or deleted
+// entry that was found, so that insertions from several threads need no lock.
+// Before copying its elements, Resize replaces all empty and deleted entries
+// of the old table with the frozen sentinel, so that an insertion racing with
+// the resize either lands before the copy or fails and is retried on the new
+// table.
 class StringTable::Data {
  public:
   static std::unique_ptr<Data> New(int capacity);
@@ -106,25 +113,41 @@ class StringTable::Data {
     slot(index).Release_Store(entry);
   }
 
-  void ElementAdded() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
-    DCHECK(StringTableHasSufficientCapacityToAdd(
-        capacity(), number_of_elements(), number_of_deleted_elements(), 1));
+  // Returns true if the entry still held {expected} and was set to {entry}.
+  bool CompareAndSet(PtrComprCageBase cage_base, InternalIndex index,
+                     Object expected, Object entry) {
+    return slot(index).Release_CompareAndSwap(cage_base, expected, entry) ==
+           expected;
+  }
 
-    number_of_elements_++;
+  // Reserves room for one more element, which is accounted for until it is
+  // released again. Returns false if the table has to be resized first, which
+  // includes shrinking a table that became very empty.
+  bool TryReserveElement() {
+    int nof = number_of_elements_.load(std::memory_order_relaxed);
+    do {
+      if (!StringTableHasSufficientCapacityToAdd(
+              capacity(), nof, number_of_deleted_elements(), 1) ||
+          ComputeStringTableCapacityWithShrink(capacity(), nof + 1) <
+              capacity()) {
+        return false;
+      }
+    } while (!number_of_elements_.compare_exchange_weak(
+        nof, nof + 1, std::memory_order_relaxed));
+    return true;
+  }
+  void ReleaseReservedElement() {
+    DCHECK_LT(0, number_of_elements());
+    number_of_elements_.fetch_sub(1, std::memory_order_relaxed);
   }
   void DeletedElementOverwritten() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
-    DCHECK(StringTableHasSufficientCapacityToAdd(
-        capacity(), number_of_elements(), number_of_deleted_elements() - 1, 1));
-
-    number_of_elements_++;
-    number_of_deleted_elements_--;
+    DCHECK_LT(0, number_of_deleted_elements());
+    number_of_deleted_elements_.fetch_sub(1, std::memory_order_relaxed);
   }
   void ElementsRemoved(int count) {
-    DCHECK_LE(count, number_of_elements_);
-    number_of_elements_ -= count;
-    number_of_deleted_elements_ += count;
+    DCHECK_LE(count, number_of_elements());
+    number_of_elements_.fetch_sub(count, std::memory_order_relaxed);
+    number_of_deleted_elements_.fetch_add(count, std::memory_order_relaxed);
   }
 
   void* operator new(size_t size, int capacity);
@@ -132,8 +155,12 @@ class StringTable::Data {
   void operator delete(void* description);
 
   int capacity() const { return capacity_; }
-  int number_of_elements() const { return number_of_elements_; }
-  int number_of_deleted_elements() const { return number_of_deleted_elements_; }
+  int number_of_elements() const {
+    return number_of_elements_.load(std::memory_order_relaxed);
+  }
+  int number_of_deleted_elements() const {
+    return number_of_deleted_elements_.load(std::memory_order_relaxed);
+  }
 
   template <typename IsolateT, typename StringTableKey>
   InternalIndex FindEntry(IsolateT* isolate, StringTableKey* key,
@@ -142,10 +169,12 @@ class StringTable::Data {
   InternalIndex FindInsertionEntry(PtrComprCageBase cage_base,
                                    uint32_t hash) const;
 
+  // Inserts {string} for {key} unless a matching string is already present,
+  // and returns the string that is in the table afterwards. Returns an empty
+  // handle if the table is full or frozen by a concurrent resize.
   template <typename IsolateT, typename StringTableKey>
-  InternalIndex FindEntryOrInsertionEntry(IsolateT* isolate,
-                                          StringTableKey* key,
-                                          uint32_t hash) const;
+  MaybeHandle<String> TryInsert(IsolateT* isolate, StringTableKey* key,
+                                Handle<String> string);
 
   // Helper method for StringTable::TryStringToIndexOrLookupExisting.
   template <typename Char>
@@ -176,8 +205,8 @@ class StringTable::Data {
 
  private:
   std::unique_ptr<Data> previous_data_;
-  int number_of_elements_;
-  int number_of_deleted_elements_;
+  std::atomic<int> number_of_elements_;
+  std::atomic<int> number_of_deleted_elements_;
   const int capacity_;
   Tagged_t elements_[1];
 };
@@ -233,17 +262,34 @@ std::unique_ptr<StringTable::Data> StringTable::Data::Resize(
       new_data->capacity(), new_data->number_of_elements(),
       new_data->number_of_deleted_elements(), data->number_of_elements()));
 
-  // Rehash the elements.
+  // Rehash the elements. Free entries are frozen first, so that elements
+  // inserted concurrently without holding the lock are either copied here or
+  // retried on the new table.
+  int number_of_elements = 0;
   for (InternalIndex i : InternalIndex::Range(data->capacity())) {
     Object element = data->Get(cage_base, i);
-    if (element == empty_element() || element == deleted_element()) continue;
+    while (element == empty_element() || element == deleted_element()) {
+      Smi frozen = element == empty_element() ? frozen_empty_element()
+                                              : frozen_deleted_element();
+      if (data->CompareAndSet(cage_base, i, element, frozen)) {
+        element = frozen;
+        break;
+      }
+      element = data->Get(cage_base, i);
+    }
+    if (element == frozen_empty_element() ||
+        element == frozen_deleted_element()) {
+      continue;
+    }
     String string = String::cast(element);
     uint32_t hash = string.hash();
     InternalIndex insertion_index =
         new_data->FindInsertionEntry(cage_base, hash);
     new_data->Set(insertion_index, string);
+    number_of_elements++;
   }
-  new_data->number_of_elements_ = data->number_of_elements();
+  new_data->number_of_elements_.store(number_of_elements,
+                                      std::memory_order_relaxed);
 
   new_data->previous_data_ = std::move(data);
   return new_data;
@@ -260,8 +306,14 @@ InternalIndex StringTable::Data::FindEntry(IsolateT* isolate,
     // TODO(leszeks): Consider delaying the decompression until after the
     // comparisons against empty/deleted.
     Object element = Get(isolate, entry);
-    if (element == empty_element()) return InternalIndex::NotFound();
-    if (element == deleted_element()) continue;
+    // Lookups may still run on a table that is being frozen by a resize, so
+    // frozen entries are treated like the entries they replaced.
+    if (element == empty_element() || element == frozen_empty_element()) {
+      return InternalIndex::NotFound();
+    }
+    if (element == deleted_element() || element == frozen_deleted_element()) {
+      continue;
+    }
     String string = String::cast(element);
     if (KeyIsMatch(isolate, key, string)) return entry;
   }
@@ -282,31 +334,67 @@ InternalIndex StringTable::Data::FindInsertionEntry(PtrComprCageBase cage_base,
 }
 
 template <typename IsolateT, typename StringTableKey>
-InternalIndex StringTable::Data::FindEntryOrInsertionEntry(
-    IsolateT* isolate, StringTableKey* key, uint32_t hash) const {
-  InternalIndex insertion_entry = InternalIndex::NotFound();
-  uint32_t count = 1;
-  // EnsureCapacity will guarantee the hash table is never full.
-  for (InternalIndex entry = FirstProbe(hash, capacity_);;
-       entry = NextProbe(entry, count++, capacity_)) {
-    // TODO(leszeks): Consider delaying the decompression until after the
-    // comparisons against empty/deleted.
-    Object element = Get(isolate, entry);
-    if (element == empty_element()) {
-      // Empty entry, it's our insertion entry if there was no previous Hole.
-      if (insertion_entry.is_not_found()) return entry;
-      return insertion_entry;
+MaybeHandle<String> StringTable::Data::TryInsert(IsolateT* isolate,
+                                                 StringTableKey* key,
+                                                 Handle<String> string) {
+  if (!TryReserveElement()) return {};
+  uint32_t hash = key->hash();
+  while (true) {
+    InternalIndex insertion_entry = InternalIndex::NotFound();
+    Object insertion_element;
+    bool frozen = false;
+    uint32_t count = 1;
+    // The reservation above guarantees the hash table is never full.
+    for (InternalIndex entry = FirstProbe(hash, capacity_);;
+         entry = NextProbe(entry, count++, capacity_)) {
+      Object element = Get(isolate, entry);
+      // A frozen table takes no more insertions, but the key may still be
+      // found further along the probe sequence.
+      if (element == frozen_empty_element()) {
+        frozen = true;
+        break;
+      }
+      if (element == frozen_deleted_element()) {
+        frozen = true;
+        continue;
+      }
+
+      if (element == empty_element()) {
+        // Empty entry, it's our insertion entry if there was no previous Hole.
+        if (insertion_entry.is_not_found()) {
+          insertion_entry = entry;
+          insertion_element = element;
+        }
+        break;
+      }
+
+      if (element == deleted_element()) {
+        // Holes are potential insertion candidates, but we continue the search
+        // in case we find the actual matching entry.
+        if (insertion_entry.is_not_found()) {
+          insertion_entry = entry;
+          insertion_element = element;
+        }
+        continue;
+      }
+
+      String existing = String::cast(element);
+      if (KeyIsMatch(isolate, key, existing)) {
+        ReleaseReservedElement();
+        return handle(existing, isolate);
+      }
     }
 
-    if (element == deleted_element()) {
-      // Holes are potential insertion candidates, but we continue the search
-      // in case we find the actual matching entry.
-      if (insertion_entry.is_not_found()) insertion_entry = entry;
-      continue;
+    if (frozen || insertion_entry.is_not_found()) {
+      ReleaseReservedElement();
+      return {};
     }
-
-    String string = String::cast(element);
-    if (KeyIsMatch(isolate, key, string)) return entry;
+    if (CompareAndSet(isolate, insertion_entry, insertion_element, *string)) {
+      if (insertion_element == deleted_element()) DeletedElementOverwritten();
+      return string;
+    }
+    // Another thread wrote to the entry in the meantime, possibly the same
+    // key or the frozen sentinel. Search again from the start.
   }
 }
 
@@ -335,10 +423,7 @@ int StringTable::Capacity() const {
   return data_.load(std::memory_order_acquire)->capacity();
 }
 int StringTable::NumberOfElements() const {
-  {
-    base::MutexGuard table_write_guard(&write_mutex_);
-    return data_.load(std::memory_order_relaxed)->number_of_elements();
-  }
+  return data_.load(std::memory_order_acquire)->number_of_elements();
 }
 
 // InternalizedStringKey carries a string/internalized-string object as key.
@@ -372,11 +457,11 @@ class InternalizedStringKey final : public StringTableKey {
         break;
       case StringTransitionStrategy::kInPlace:
         // A relaxed write is sufficient here even with concurrent
-        // internalization. Though it is not synchronizing, a thread that does
-        // not see the relaxed write will wait on the string table write
-        // mutex. When that thread acquires that mutex, the ordering of the
-        // mutex's underlying memory access will force this map update to become
-        // visible to it.
+        // internalization. Though it is not synchronizing, the string is
+        // published by a release compare-and-swap on the string table entry.
+        // A thread that does not see the relaxed write either fails its own
+        // compare-and-swap or finds this string on its acquire re-lookup,
+        // either of which makes this map update visible to it.
         string_->set_map_no_write_barrier(
             *maybe_internalized_map.ToHandleChecked());
         DCHECK(string_->IsInternalizedString());
@@ -434,8 +519,8 @@ Handle<String> StringTable::LookupString(Isolate* isolate,
   //  - In-place internalizable strings do not incur a copy regardless of string
   //    table sharing. The map mutation is threadsafe even with relaxed memory
   //    order, because for concurrent table lookups, the "losing" thread will be
-  //    correctly ordered by LookupKey's write mutex and see the updated map
-  //    during the re-lookup.
+  //    correctly ordered by the compare-and-swap of the "winning" thread in
+  //    LookupKey and see the updated map during the re-lookup.
   //
   // For lookup misses, the internalized string map is the same map in RO space
   // regardless of which thread is doing the lookup.
@@ -462,10 +547,11 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   //
   //   - The Heap access is allowed to be concurrent (using LocalHeap or
   //     similar),
-  //   - All writes to the string table are guarded by the Isolate string table
-  //     mutex,
-  //   - Resizes of the string table first copies the old contents to the new
-  //     table, and only then sets the new string table pointer to the new
+  //   - Elements are only ever written into empty or deleted entries, using a
+  //     compare-and-swap,
+  //   - Resizes of the string table are guarded by the Isolate string table
+  //     mutex, freeze the old table, then copy the old contents to the new
+  //     table, and only then set the new string table pointer to the new
   //     table,
   //   - Only GCs can remove elements from the string table.
   //
@@ -482,15 +568,17 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   //
   // We therefore try to optimistically read from the string table without
   // taking the lock (both here and in the NoAllocate version of the lookup),
-  // and on a miss we take the lock and try to write the entry, with a second
-  // read lookup in case the non-locked read missed a write.
+  // and on a miss we try to write the entry with a compare-and-swap, with a
+  // second read lookup in case the first read missed a write. Only if the
+  // table needs to grow, or is frozen by a concurrent resize, we take the lock.
+  // Internalizing the same strings from many threads therefore does not
+  // contend on the lock.
   //
   // One complication is allocation -- we don't want to allocate while holding
-  // the string table lock. This applies to both allocation of new strings, and
-  // re-allocation of the string table on resize. So, we optimistically allocate
-  // (without copying values) outside the lock, and potentially discard the
-  // allocation if another write also did an allocation. This assumes that
-  // writes are rarer than reads.
+  // the string table lock. This applies to allocation of new strings. So, we
+  // optimistically allocate (without copying values) before inserting, and
+  // potentially discard the allocation if another write also did an
+  // allocation. This assumes that writes are rarer than reads.
 
   // Load the current string table data, in case another thread updates the
   // data while we're reading.
@@ -518,31 +606,22 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   Handle<String> new_string = key->AsHandle(isolate);
   DCHECK_IMPLIES(FLAG_shared_string_table, new_string->IsShared());
 
-  {
-    base::MutexGuard table_write_guard(&write_mutex_);
-
-    Data* data = EnsureCapacity(isolate, 1);
-
-    // Check one last time if the key is present in the table, in case it was
-    // added after the check.
-    entry = data->FindEntryOrInsertionEntry(isolate, key, key->hash());
-
-    Object element = data->Get(isolate, entry);
-    if (element == empty_element()) {
-      // This entry is empty, so write it and register that we added an
-      // element.
-      data->Set(entry, *new_string);
-      data->ElementAdded();
-      return new_string;
-    } else if (element == deleted_element()) {
-      // This entry was deleted, so overwrite it and register that we
-      // overwrote a deleted element.
-      data->Set(entry, *new_string);
-      data->DeletedElementOverwritten();
-      return new_string;
-    } else {
-      // Return the existing string as a handle.
-      return handle(String::cast(element), isolate);
+  // Try to insert without the lock first. This checks one last time if the
+  // key is present in the table, in case it was added after the check.
+  Handle<String> result;
+  Data* data = data_.load(std::memory_order_acquire);
+  if (data->TryInsert(isolate, key, new_string).ToHandle(&result)) {
+    return result;
+  }
+
+  // The table is full or being resized, so resize it under the lock if that
+  // has not happened yet. Lock-free insertions may fill up the new table
+  // before this thread gets to insert, in which case it is resized again.
+  base::MutexGuard table_write_guard(&write_mutex_);
+  while (true) {
+    data = EnsureCapacity(isolate, 1);
+    if (data->TryInsert(isolate, key, new_string).ToHandle(&result)) {
+      return result;
     }
   }
 }
@@ -595,6 +674,8 @@ StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
   }
 
   if (new_capacity != -1) {
+    // Insertions that do not hold the lock may still race with the resize,
+    // see Data::Resize.
     std::unique_ptr<Data> new_data =
         Data::Resize(cage_base, std::unique_ptr<Data>(data), new_capacity);
     // `new_data` is the new owner of `data`.
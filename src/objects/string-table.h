@@ -41,7 +41,8 @@ class StringTableKey {
 class SeqOneByteString;
 
 // StringTable, for internalizing strings. The Lookup methods are designed to be
-// thread-safe, in combination with GC safepoints.
+// thread-safe, in combination with GC safepoints. Insertions are lock-free as
+// long as the table has enough capacity; only resizes take the write mutex.
 //
 // The string table layout is defined by its Data implementation class, see
 // StringTable::Data for details.
@@ -49,6 +50,12 @@ class V8_EXPORT_PRIVATE StringTable {
  public:
   static constexpr Smi empty_element() { return Smi::FromInt(0); }
   static constexpr Smi deleted_element() { return Smi::FromInt(1); }
+  // Written into the empty and deleted entries of a table that is being
+  // replaced by a resize, so that no further lock-free insertions into it
+  // succeed. They are kept apart so that lookups in the frozen table still
+  // probe past former deleted entries.
+  static constexpr Smi frozen_empty_element() { return Smi::FromInt(2); }
+  static constexpr Smi frozen_deleted_element() { return Smi::FromInt(3); }
 
   explicit StringTable(Isolate* isolate);
   ~StringTable();
@@ -90,9 +97,9 @@ class V8_EXPORT_PRIVATE StringTable {
   Data* EnsureCapacity(PtrComprCageBase cage_base, int additional_elements);
 
   std::atomic<Data*> data_;
-  // Write mutex is mutable so that readers of concurrently mutated values (e.g.
-  // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::Mutex write_mutex_;
+  // Mutex serializing resizes of the table. Insertions into a table with
+  // enough capacity do not take it.
+  base::Mutex write_mutex_;
   Isolate* isolate_;
 };
 
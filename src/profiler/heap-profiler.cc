@@ -104,6 +104,30 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
   return result;
 }
 
+bool HeapProfiler::TakeStreamingSnapshot(
+    v8::OutputStream* stream, v8::ActivityControl* control,
+    v8::HeapProfiler::ObjectNameResolver* resolver,
+    bool treat_global_objects_as_roots, bool capture_numeric_value) {
+  is_taking_snapshot_ = true;
+  bool result;
+  {
+    HeapSnapshot snapshot(this, treat_global_objects_as_roots,
+                          capture_numeric_value);
+    HeapSnapshotStreamingSerializer serializer(&snapshot, stream);
+    snapshot.set_streaming_serializer(&serializer);
+    HeapSnapshotGenerator generator(&snapshot, control, resolver, heap());
+    result = generator.GenerateSnapshot() && serializer.Finish();
+  }
+  ids_->RemoveDeadEntries();
+  is_tracking_object_moves_ = true;
+  is_taking_snapshot_ = false;
+
+  heap()->isolate()->debug()->feature_tracker()->Track(
+      DebugFeatureTracker::kHeapSnapshot);
+
+  return result;
+}
+
 bool HeapProfiler::StartSamplingHeapProfiler(
     uint64_t sample_interval, int stack_depth,
     v8::HeapProfiler::SamplingFlags flags) {
@@ -35,6 +35,13 @@ class HeapProfiler : public HeapObjectAllocationTracker {
                              v8::HeapProfiler::ObjectNameResolver* resolver,
                              bool treat_global_objects_as_roots,
                              bool capture_numeric_value);
+  // Takes a snapshot that is written to |stream| while it is generated. The
+  // snapshot is not retained. Returns false if the snapshot was aborted.
+  bool TakeStreamingSnapshot(v8::OutputStream* stream,
+                             v8::ActivityControl* control,
+                             v8::HeapProfiler::ObjectNameResolver* resolver,
+                             bool treat_global_objects_as_roots,
+                             bool capture_numeric_value);
 
   bool StartSamplingHeapProfiler(uint64_t sample_interval, int stack_depth,
                                  v8::HeapProfiler::SamplingFlags);
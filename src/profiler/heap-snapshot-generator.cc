@@ -82,6 +82,11 @@ void HeapEntry::SetNamedReference(HeapGraphEdge::Type type,
                                   const char* name,
                                   HeapEntry* entry) {
   ++children_count_;
+  if (HeapSnapshotStreamingSerializer* serializer =
+          snapshot_->streaming_serializer()) {
+    serializer->SerializeEdge(HeapGraphEdge(type, name, this, entry));
+    return;
+  }
   snapshot_->edges().emplace_back(type, name, this, entry);
 }
 
@@ -89,6 +94,11 @@ void HeapEntry::SetIndexedReference(HeapGraphEdge::Type type,
                                     int index,
                                     HeapEntry* entry) {
   ++children_count_;
+  if (HeapSnapshotStreamingSerializer* serializer =
+          snapshot_->streaming_serializer()) {
+    serializer->SerializeEdge(HeapGraphEdge(type, index, this, entry));
+    return;
+  }
   snapshot_->edges().emplace_back(type, index, this, entry);
 }
 
@@ -2308,7 +2318,8 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
 
   if (!FillReferences()) return false;
 
-  snapshot_->FillChildren();
+  // Streamed edges are not retained, so there are no children to fill in.
+  if (!snapshot_->streaming_serializer()) snapshot_->FillChildren();
   snapshot_->RememberLastJSObjectId();
 
   progress_counter_ = progress_total_;
@@ -2332,6 +2343,9 @@ void HeapSnapshotGenerator::ProgressStep() {
 
 bool HeapSnapshotGenerator::ProgressReport(bool force) {
   const int kProgressReportGranularity = 10000;
+  HeapSnapshotStreamingSerializer* serializer =
+      snapshot_->streaming_serializer();
+  if (serializer && serializer->aborted()) return false;
   if (control_ != nullptr &&
       (force || progress_counter_ % kProgressReportGranularity == 0)) {
     return control_->ReportProgressValue(progress_counter_, progress_total_) ==
@@ -2857,53 +2871,58 @@ void HeapSnapshotJSONSerializer::SerializeSamples() {
 }
 
 
-void HeapSnapshotJSONSerializer::SerializeString(const unsigned char* s) {
-  writer_->AddCharacter('\n');
-  writer_->AddCharacter('\"');
+static void WriteJSONString(OutputStreamWriter* w, const unsigned char* s) {
+  w->AddCharacter('\"');
   for ( ; *s != '\0'; ++s) {
     switch (*s) {
       case '\b':
-        writer_->AddString("\\b");
+        w->AddString("\\b");
         continue;
       case '\f':
-        writer_->AddString("\\f");
+        w->AddString("\\f");
         continue;
       case '\n':
-        writer_->AddString("\\n");
+        w->AddString("\\n");
         continue;
       case '\r':
-        writer_->AddString("\\r");
+        w->AddString("\\r");
         continue;
       case '\t':
-        writer_->AddString("\\t");
+        w->AddString("\\t");
         continue;
       case '\"':
       case '\\':
-        writer_->AddCharacter('\\');
-        writer_->AddCharacter(*s);
+        w->AddCharacter('\\');
+        w->AddCharacter(*s);
         continue;
       default:
         if (*s > 31 && *s < 128) {
-          writer_->AddCharacter(*s);
+          w->AddCharacter(*s);
         } else if (*s <= 31) {
           // Special character with no dedicated literal.
-          WriteUChar(writer_, *s);
+          WriteUChar(w, *s);
         } else {
           // Convert UTF-8 into \u UTF-16 literal.
           size_t length = 1, cursor = 0;
           for ( ; length <= 4 && *(s + length) != '\0'; ++length) { }
           unibrow::uchar c = unibrow::Utf8::CalculateValue(s, length, &cursor);
           if (c != unibrow::Utf8::kBadChar) {
-            WriteUChar(writer_, c);
+            WriteUChar(w, c);
             DCHECK_NE(cursor, 0);
             s += cursor - 1;
           } else {
-            writer_->AddCharacter('?');
+            w->AddCharacter('?');
           }
         }
     }
   }
-  writer_->AddCharacter('\"');
+  w->AddCharacter('\"');
+}
+
+
+void HeapSnapshotJSONSerializer::SerializeString(const unsigned char* s) {
+  writer_->AddCharacter('\n');
+  WriteJSONString(writer_, s);
 }
 
 
@@ -2951,5 +2970,194 @@ void HeapSnapshotJSONSerializer::SerializeLocations() {
   }
 }
 
+HeapSnapshotStreamingSerializer::HeapSnapshotStreamingSerializer(
+    HeapSnapshot* snapshot, v8::OutputStream* stream)
+    : snapshot_(snapshot),
+      writer_(std::make_unique<OutputStreamWriter>(stream)),
+      strings_(HeapSnapshotJSONSerializer::StringsMatch) {
+  SerializeHeader();
+}
+
+HeapSnapshotStreamingSerializer::~HeapSnapshotStreamingSerializer() = default;
+
+bool HeapSnapshotStreamingSerializer::aborted() const {
+  return writer_->aborted();
+}
+
+int HeapSnapshotStreamingSerializer::GetStringId(const char* s) {
+  base::HashMap::Entry* cache_entry = strings_.LookupOrInsert(
+      const_cast<char*>(s), HeapSnapshotJSONSerializer::StringHash(s));
+  if (cache_entry->value == nullptr) {
+    const int id = next_string_id_++;
+    cache_entry->value = reinterpret_cast<void*>(static_cast<intptr_t>(id));
+    // Strings are defined right before the first record referring to them.
+    writer_->AddCharacter('[');
+    writer_->AddNumber(kString);
+    writer_->AddCharacter(',');
+    writer_->AddNumber(id);
+    writer_->AddCharacter(',');
+    WriteJSONString(writer_.get(), reinterpret_cast<const unsigned char*>(s));
+    writer_->AddString("]\n");
+  }
+  return static_cast<int>(reinterpret_cast<intptr_t>(cache_entry->value));
+}
+
+void HeapSnapshotStreamingSerializer::SerializeHeader() {
+// clang-format off
+#define JSON_A(s) "[" s "]"
+#define JSON_O(s) "{" s "}"
+#define JSON_S(s) "\"" s "\""
+  writer_->AddString(JSON_O(
+    JSON_S("record_types") ":" JSON_A(
+        JSON_S("string") ","
+        JSON_S("node") ","
+        JSON_S("edge") ","
+        JSON_S("location")) ","
+    JSON_S("string_fields") ":" JSON_A(
+        JSON_S("id") ","
+        JSON_S("value")) ","
+    JSON_S("node_fields") ":" JSON_A(
+        JSON_S("type") ","
+        JSON_S("name") ","
+        JSON_S("id") ","
+        JSON_S("self_size") ","
+        JSON_S("edge_count") ","
+        JSON_S("trace_node_id") ","
+        JSON_S("detachedness")) ","
+    JSON_S("node_types") ":" JSON_A(
+        JSON_S("hidden") ","
+        JSON_S("array") ","
+        JSON_S("string") ","
+        JSON_S("object") ","
+        JSON_S("code") ","
+        JSON_S("closure") ","
+        JSON_S("regexp") ","
+        JSON_S("number") ","
+        JSON_S("native") ","
+        JSON_S("synthetic") ","
+        JSON_S("concatenated string") ","
+        JSON_S("sliced string") ","
+        JSON_S("symbol") ","
+        JSON_S("bigint")) ","
+    JSON_S("edge_fields") ":" JSON_A(
+        JSON_S("from_node") ","
+        JSON_S("type") ","
+        JSON_S("name_or_index") ","
+        JSON_S("to_node")) ","
+    JSON_S("edge_types") ":" JSON_A(
+        JSON_S("context") ","
+        JSON_S("element") ","
+        JSON_S("property") ","
+        JSON_S("internal") ","
+        JSON_S("hidden") ","
+        JSON_S("shortcut") ","
+        JSON_S("weak")) ","
+    JSON_S("location_fields") ":" JSON_A(
+        JSON_S("node") ","
+        JSON_S("script_id") ","
+        JSON_S("line") ","
+        JSON_S("column"))) "\n");
+// clang-format on
+#undef JSON_S
+#undef JSON_O
+#undef JSON_A
+}
+
+void HeapSnapshotStreamingSerializer::SerializeEdge(const HeapGraphEdge& edge) {
+  if (aborted()) return;
+  // The buffer needs space for 5 unsigned ints, 4 commas, [, ], \n and \0
+  static const int kBufferSize =
+      MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned * 5 + 4 + 4;
+  base::EmbeddedVector<char, kBufferSize> buffer;
+  int edge_name_or_index = edge.type() == HeapGraphEdge::kElement ||
+                                   edge.type() == HeapGraphEdge::kHidden
+                               ? edge.index()
+                               : GetStringId(edge.name());
+  int buffer_pos = 0;
+  buffer[buffer_pos++] = '[';
+  buffer_pos = utoa(kEdge, buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(edge.from()->id(), buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(edge.type(), buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(edge_name_or_index, buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(edge.to()->id(), buffer, buffer_pos);
+  buffer[buffer_pos++] = ']';
+  buffer[buffer_pos++] = '\n';
+  buffer[buffer_pos++] = '\0';
+  writer_->AddString(buffer.begin());
+}
+
+void HeapSnapshotStreamingSerializer::SerializeNode(const HeapEntry& entry) {
+  // The buffer needs space for 6 unsigned ints, 1 size_t, 1 uint8_t, 7 commas,
+  // [, ], \n and \0
+  static const int kBufferSize =
+      6 * MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned +
+      MaxDecimalDigitsIn<sizeof(size_t)>::kUnsigned +
+      MaxDecimalDigitsIn<sizeof(uint8_t)>::kUnsigned + 7 + 4;
+  base::EmbeddedVector<char, kBufferSize> buffer;
+  const int name_id = GetStringId(entry.name());
+  int buffer_pos = 0;
+  buffer[buffer_pos++] = '[';
+  buffer_pos = utoa(kNode, buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(entry.type(), buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(name_id, buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(entry.id(), buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(entry.self_size(), buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(entry.added_children_count(), buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(entry.trace_node_id(), buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(entry.detachedness(), buffer, buffer_pos);
+  buffer[buffer_pos++] = ']';
+  buffer[buffer_pos++] = '\n';
+  buffer[buffer_pos++] = '\0';
+  writer_->AddString(buffer.begin());
+}
+
+void HeapSnapshotStreamingSerializer::SerializeLocation(
+    const SourceLocation& location) {
+  // The buffer needs space for 5 unsigned ints, 4 commas, [, ], \n and \0
+  static const int kBufferSize =
+      MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned * 5 + 4 + 4;
+  base::EmbeddedVector<char, kBufferSize> buffer;
+  int buffer_pos = 0;
+  buffer[buffer_pos++] = '[';
+  buffer_pos = utoa(kLocation, buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(snapshot_->entries()[location.entry_index].id(), buffer,
+                    buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(location.scriptId, buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(location.line, buffer, buffer_pos);
+  buffer[buffer_pos++] = ',';
+  buffer_pos = utoa(location.col, buffer, buffer_pos);
+  buffer[buffer_pos++] = ']';
+  buffer[buffer_pos++] = '\n';
+  buffer[buffer_pos++] = '\0';
+  writer_->AddString(buffer.begin());
+}
+
+bool HeapSnapshotStreamingSerializer::Finish() {
+  for (const HeapEntry& entry : snapshot_->entries()) {
+    SerializeNode(entry);
+    if (aborted()) return false;
+  }
+  for (const SourceLocation& location : snapshot_->locations()) {
+    SerializeLocation(location);
+    if (aborted()) return false;
+  }
+  writer_->Finalize();
+  return !aborted();
+}
+
 }  // namespace internal
 }  // namespace v8
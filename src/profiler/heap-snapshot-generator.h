@@ -32,6 +32,7 @@ class HeapEntry;
 class HeapProfiler;
 class HeapSnapshot;
 class HeapSnapshotGenerator;
+class HeapSnapshotStreamingSerializer;
 class JSArrayBuffer;
 class JSCollection;
 class JSGeneratorObject;
@@ -131,6 +132,9 @@ class HeapEntry {
   unsigned trace_node_id() const { return trace_node_id_; }
   int index() const { return index_; }
   V8_INLINE int children_count() const;
+  // Number of edges added so far. Only valid before FillChildren(), which is
+  // never called for streamed snapshots.
+  int added_children_count() const { return children_count_; }
   V8_INLINE int set_children_index(int index);
   V8_INLINE void add_child(HeapGraphEdge* edge);
   V8_INLINE HeapGraphEdge* child(int i);
@@ -217,6 +221,15 @@ class HeapSnapshot {
   }
   bool capture_numeric_value() const { return capture_numeric_value_; }
 
+  // Set while the snapshot is streamed. Edges are then written out as they are
+  // added instead of being retained in |edges_|.
+  HeapSnapshotStreamingSerializer* streaming_serializer() const {
+    return streaming_serializer_;
+  }
+  void set_streaming_serializer(HeapSnapshotStreamingSerializer* serializer) {
+    streaming_serializer_ = serializer;
+  }
+
   void AddLocation(HeapEntry* entry, int scriptId, int line, int col);
   HeapEntry* AddEntry(HeapEntry::Type type,
                       const char* name,
@@ -247,6 +260,7 @@ class HeapSnapshot {
   std::unordered_map<SnapshotObjectId, HeapEntry*> entries_by_id_cache_;
   std::vector<SourceLocation> locations_;
   SnapshotObjectId max_snapshot_js_object_id_ = -1;
+  HeapSnapshotStreamingSerializer* streaming_serializer_ = nullptr;
   bool treat_global_objects_as_roots_;
   bool capture_numeric_value_;
 };
@@ -629,6 +643,43 @@ class HeapSnapshotJSONSerializer {
 
   friend class HeapSnapshotJSONSerializerEnumerator;
   friend class HeapSnapshotJSONSerializerIterator;
+  friend class HeapSnapshotStreamingSerializer;
+};
+
+// Writes a heap snapshot while it is being generated, see
+// v8::HeapProfiler::TakeStreamingHeapSnapshot() for the format. Edges are
+// written as soon as they are added to the snapshot and are not retained.
+// Nodes are written once generation is finished as their names, types and
+// sizes may still be updated until then.
+class HeapSnapshotStreamingSerializer {
+ public:
+  HeapSnapshotStreamingSerializer(HeapSnapshot* snapshot,
+                                  v8::OutputStream* stream);
+  ~HeapSnapshotStreamingSerializer();
+  HeapSnapshotStreamingSerializer(const HeapSnapshotStreamingSerializer&) =
+      delete;
+  HeapSnapshotStreamingSerializer& operator=(
+      const HeapSnapshotStreamingSerializer&) = delete;
+
+  void SerializeEdge(const HeapGraphEdge& edge);
+  // Writes nodes and locations and ends the stream. Returns false if the
+  // embedder aborted the stream.
+  bool Finish();
+
+  bool aborted() const;
+
+ private:
+  enum RecordType { kString = 0, kNode = 1, kEdge = 2, kLocation = 3 };
+
+  int GetStringId(const char* s);
+  void SerializeHeader();
+  void SerializeNode(const HeapEntry& entry);
+  void SerializeLocation(const SourceLocation& location);
+
+  HeapSnapshot* snapshot_;
+  std::unique_ptr<OutputStreamWriter> writer_;
+  base::CustomMatcherHashMap strings_;
+  int next_string_id_ = 1;
 };
 
 
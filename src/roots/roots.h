@@ -316,6 +316,8 @@ class Symbol;
     InterpreterEntryTrampolineForProfiling)                                \
   V(Object, pending_optimize_for_test_bytecode,                            \
     PendingOptimizeForTestBytecode)                                        \
+  /* Pretenuring feedback of literals inlined into optimized code */       \
+  V(Object, context_allocation_sites, ContextAllocationSites)              \
   V(ArrayList, basic_block_profiling_data, BasicBlockProfilingData)        \
   V(WeakArrayList, shared_wasm_memories, SharedWasmMemories)               \
   IF_WASM(V, HeapObject, active_continuation, ActiveContinuation)          \
@@ -213,6 +213,11 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
     return ReadOnlyRoots(isolate).undefined_value();
   }
 
+  // Drop the tiering hint from the code cache or snapshot, so that the
+  // function is not optimized again after a single tick, only to deoptimize
+  // once more. It has to warm up normally instead.
+  function->shared().set_is_known_hot(false);
+
   // Invalidate the underlying optimized code on eager and soft deopts.
   if (type == DeoptimizeKind::kEager || type == DeoptimizeKind::kSoft) {
     Deoptimizer::DeoptimizeFunction(*function, *optimized_code);
@@ -312,6 +317,10 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
 
   MaybeHandle<CodeT> maybe_result;
   Handle<JSFunction> function(frame->function(), isolate);
+  const ConcurrencyMode mode =
+      FLAG_concurrent_osr && isolate->concurrent_recompilation_enabled()
+          ? ConcurrencyMode::kConcurrent
+          : ConcurrencyMode::kNotConcurrent;
   if (IsSuitableForOnStackReplacement(isolate, function)) {
     if (FLAG_trace_osr) {
       CodeTracer::Scope scope(isolate->GetCodeTracer());
@@ -319,8 +328,22 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
       function->PrintName(scope.file());
       PrintF(scope.file(), " at OSR bytecode offset %d]\n", osr_offset.ToInt());
     }
-    maybe_result =
-        Compiler::GetOptimizedCodeForOSR(isolate, function, osr_offset, frame);
+    maybe_result = Compiler::GetOptimizedCodeForOSR(isolate, function,
+                                                    osr_offset, frame, mode);
+    if (maybe_result.is_null() && mode == ConcurrencyMode::kConcurrent &&
+        !isolate->has_pending_exception()) {
+      // The job was queued (or could not be queued right now). Continue in
+      // the unoptimized frame; back edges are re-armed once the job has been
+      // finalized.
+      if (FLAG_trace_osr) {
+        CodeTracer::Scope scope(isolate->GetCodeTracer());
+        PrintF(scope.file(), "[OSR - Continuing without OSR code: ");
+        function->PrintName(scope.file());
+        PrintF(scope.file(), " at OSR bytecode offset %d]\n",
+               osr_offset.ToInt());
+      }
+      return Object();
+    }
   }
 
   // Check whether we ended up with usable optimized code.
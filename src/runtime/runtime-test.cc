@@ -623,7 +623,10 @@ RUNTIME_FUNCTION(Runtime_GetOptimizationStatus) {
   } else if (function->IsMarkedForConcurrentOptimization()) {
     status |=
         static_cast<int>(OptimizationStatus::kMarkedForConcurrentOptimization);
-  } else if (function->IsInOptimizationQueue()) {
+  } else if (function->IsInOptimizationQueue() ||
+             (isolate->concurrent_recompilation_enabled() &&
+              isolate->optimizing_compile_dispatcher()->HasPendingOsrJob(
+                  *function))) {
     status |= static_cast<int>(OptimizationStatus::kOptimizingConcurrently);
   }
 
@@ -9,11 +9,13 @@
 #include "src/base/platform/platform.h"
 #include "src/common/assert-scope.h"
 #include "src/execution/isolate-inl.h"
+#include "src/execution/runtime-profiler.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/code-kind.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/snapshot/context-deserializer.h"
 #include "src/snapshot/context-serializer.h"
@@ -321,6 +323,32 @@ void Snapshot::ClearReconstructableDataForSerialization(
   }
 }
 
+// static
+void Snapshot::RecordTieringHintsForSerialization(Isolate* isolate) {
+  PtrComprCageBase cage_base(isolate);
+  // Functions of an already disposed warm-up context are still visited, as
+  // long as no GC has collected them yet.
+  i::HeapObjectIterator it(isolate->heap());
+  for (i::HeapObject o = it.Next(); !o.is_null(); o = it.Next()) {
+    if (!o.IsJSFunction(cage_base)) continue;
+
+    i::JSFunction fun = i::JSFunction::cast(o);
+    bool is_hot = fun.HasAttachedOptimizedCode();
+    if (!is_hot && fun.has_feedback_vector()) {
+      // A function that was not optimized only counts as hot if it collected
+      // enough ticks to be optimized by TurboFan. A few ticks are gathered by
+      // almost any function that runs during the warm-up.
+      i::FeedbackVector vector = fun.feedback_vector();
+      is_hot = vector.has_optimized_code() ||
+               (fun.shared().HasBytecodeArray() &&
+                vector.profiler_ticks() >=
+                    RuntimeProfiler::TicksForOptimization(
+                        fun.shared().GetBytecodeArray(isolate).length()));
+    }
+    if (is_hot) fun.shared().set_is_known_hot(true);
+  }
+}
+
 // static
 void Snapshot::SerializeDeserializeAndVerifyForTesting(
     Isolate* isolate, Handle<Context> default_context) {
@@ -785,6 +813,11 @@ v8::StartupData WarmUpSnapshotDataBlobInternal(
       return {};
     }
   }
+  if (FLAG_snapshot_tiering_hints) {
+    // Record the hot functions while the warm-up context is still around.
+    Snapshot::RecordTieringHintsForSerialization(
+        reinterpret_cast<Isolate*>(isolate));
+  }
   {
     v8::HandleScope handle_scope(isolate);
     isolate->ContextDisposedNotification(false);
@@ -58,6 +58,13 @@ class Snapshot : public AllStatic {
   V8_EXPORT_PRIVATE static void ClearReconstructableDataForSerialization(
       Isolate* isolate, bool clear_recompilable_data);
 
+  // Marks the shared function infos of functions that got optimized, or
+  // collected enough ticks to be optimized, in the given isolate as known hot. The bit is serialized with the function
+  // and lets it tier up right after its first tick once deserialized.
+  // Optimized code itself is never serialized into the snapshot.
+  V8_EXPORT_PRIVATE static void RecordTieringHintsForSerialization(
+      Isolate* isolate);
+
   // Serializes the given isolate and contexts. Each context may have an
   // associated callback to serialize internal fields. The default context must
   // be passed at index 0.
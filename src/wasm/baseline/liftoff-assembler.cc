@@ -864,6 +864,35 @@ void LiftoffAssembler::SpillLocals() {
   }
 }
 
+void LiftoffAssembler::PrepareLoopLocals() {
+  // Locals which are in a register exclusively owned by that local can stay in
+  // that register across the loop header; the back-edge merge then just moves
+  // values between registers instead of going through the stack. Constants and
+  // registers shared with other stack slots would need to be materialized on
+  // every back-edge, so spill those.
+  for (uint32_t i = 0; i < num_locals_; ++i) {
+    VarState* slot = &cache_state_.stack_state[i];
+    if (slot->is_const() ||
+        (slot->is_reg() && cache_state_.get_use_count(slot->reg()) > 1)) {
+      Spill(slot);
+    }
+  }
+  // Keep at least half of the cache registers of each class free for the loop
+  // body. Spill locals (starting from the last one) until that is the case.
+  constexpr unsigned kMinFreeGpRegs = kGpCacheRegList.GetNumRegsSet() / 2;
+  constexpr unsigned kMinFreeFpRegs = kFpCacheRegList.GetNumRegsSet() / 2;
+  for (uint32_t i = num_locals_; i > 0; --i) {
+    VarState* slot = &cache_state_.stack_state[i - 1];
+    if (!slot->is_reg()) continue;
+    bool is_gp = slot->reg().is_gp() || slot->reg().is_gp_pair();
+    LiftoffRegList cache_regs = is_gp ? kGpCacheRegList : kFpCacheRegList;
+    unsigned min_free = is_gp ? kMinFreeGpRegs : kMinFreeFpRegs;
+    unsigned num_free =
+        cache_regs.MaskOut(cache_state_.used_registers).GetNumRegsSet();
+    if (num_free < min_free) Spill(slot);
+  }
+}
+
 void LiftoffAssembler::SpillAllRegisters() {
   for (uint32_t i = 0, e = cache_state_.stack_height(); i < e; ++i) {
     auto& slot = cache_state_.stack_state[i];
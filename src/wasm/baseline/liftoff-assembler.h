@@ -595,6 +595,9 @@ class LiftoffAssembler : public TurboAssembler {
 
   void Spill(VarState* slot);
   void SpillLocals();
+  // Spill locals before entering a loop, but keep as many of them in registers
+  // as register pressure allows.
+  void PrepareLoopLocals();
   void SpillAllRegisters();
 
   // Clear any uses of {reg} in both the cache and in {possible_uses}.
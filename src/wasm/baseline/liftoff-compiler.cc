@@ -1166,12 +1166,19 @@ class LiftoffCompiler {
   void Block(FullDecoder* decoder, Control* block) { PushControl(block); }
 
   void Loop(FullDecoder* decoder, Control* loop) {
-    // Before entering a loop, spill all locals to the stack, in order to free
-    // the cache registers, and to avoid unnecessarily reloading stack values
-    // into registers at branches.
+    // Before entering a loop, spill locals to the stack, in order to free the
+    // cache registers, and to avoid unnecessarily reloading stack values into
+    // registers at branches. If register pressure allows, keep locals in their
+    // registers instead; the back-edge then only needs register moves.
+    // Debug code expects all locals on the stack.
     // TODO(clemensb): Come up with a better strategy here, involving
     // pre-analysis of the function.
-    __ SpillLocals();
+    if (FLAG_liftoff_loop_locals_in_registers &&
+        for_debugging_ == kNoDebugging) {
+      __ PrepareLoopLocals();
+    } else {
+      __ SpillLocals();
+    }
 
     __ PrepareLoopArgs(loop->start_merge.arity);
 
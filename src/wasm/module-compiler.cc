@@ -1092,8 +1092,11 @@ DecodeResult ValidateSingleFunction(const WasmModule* module, int func_index,
                                     WasmFeatures enabled_features) {
   const WasmFunction* func = &module->functions[func_index];
   FunctionBody body{func->sig, func->code.offset(), code.begin(), code.end()};
-  DecodeResult result;
-
+  base::Optional<TimedHistogramScope> validate_function_time_scope;
+  if (counters) {
+    validate_function_time_scope.emplace(
+        counters->wasm_validate_wasm_function_time());
+  }
   WasmFeatures detected;
   return VerifyWasmCode(allocator, enabled_features, module, &detected, body);
 }
@@ -1103,34 +1106,142 @@ enum OnlyLazyFunctions : bool {
   kOnlyLazyFunctions = true,
 };
 
-void ValidateSequentially(
+// Keeps the error of the invalid function with the lowest index, so that the
+// reported error does not depend on the scheduling of the validation workers.
+class FirstValidationError {
+ public:
+  explicit FirstValidationError(int end) : func_index_(end), end_(end) {}
+
+  // Validation of functions with a higher index can be skipped.
+  int func_index() const { return func_index_.load(std::memory_order_relaxed); }
+  bool has_error() const { return func_index() != end_; }
+
+  void Record(int func_index, WasmError error) {
+    base::MutexGuard guard(&mutex_);
+    if (func_index >= this->func_index()) return;
+    error_ = std::move(error);
+    func_index_.store(func_index, std::memory_order_relaxed);
+  }
+
+  // Must only be called once all validation workers have finished.
+  WasmError& error() {
+    DCHECK(has_error());
+    return error_;
+  }
+
+ private:
+  std::atomic<int> func_index_;
+  const int end_;
+  base::Mutex mutex_;
+  WasmError error_;
+};
+
+// Validates function bodies in parallel. Each worker claims the next function
+// index and stops once a function with a lower index failed validation.
+class ValidateFunctionsJob final : public JobTask {
+ public:
+  ValidateFunctionsJob(const WasmModule* module, ModuleWireBytes wire_bytes,
+                       WasmFeatures enabled_features, bool lazy_module,
+                       OnlyLazyFunctions only_lazy_functions,
+                       Counters* counters, AccountingAllocator* allocator,
+                       FirstValidationError* first_error)
+      : module_(module),
+        wire_bytes_(wire_bytes),
+        enabled_features_(enabled_features),
+        lazy_module_(lazy_module),
+        only_lazy_functions_(only_lazy_functions),
+        counters_(counters),
+        allocator_(allocator),
+        next_function_(module->num_imported_functions),
+        first_error_(first_error) {}
+
+  void Run(JobDelegate* delegate) override {
+    do {
+      int func_index = next_function_.fetch_add(1, std::memory_order_relaxed);
+      // Stop if all functions are taken, or if a function with a lower index
+      // already failed validation.
+      if (func_index >= first_error_->func_index()) return;
+      if (only_lazy_functions_ && !IsLazyFunction(func_index)) continue;
+      const WasmFunction* func = &module_->functions[func_index];
+      DecodeResult result = ValidateSingleFunction(
+          module_, func_index, wire_bytes_.GetFunctionBytes(func), counters_,
+          allocator_, enabled_features_);
+      if (result.failed()) {
+        first_error_->Record(func_index, std::move(result).error());
+      }
+    } while (!delegate || !delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    DCHECK_GE(FLAG_wasm_num_compilation_tasks, 1);
+    int remaining = first_error_->func_index() -
+                    next_function_.load(std::memory_order_relaxed);
+    return std::min(static_cast<size_t>(FLAG_wasm_num_compilation_tasks),
+                    static_cast<size_t>(std::max(0, remaining)));
+  }
+
+ private:
+  bool IsLazyFunction(int func_index) const {
+    CompileStrategy strategy = GetCompileStrategy(module_, enabled_features_,
+                                                  func_index, lazy_module_);
+    return strategy == CompileStrategy::kLazy ||
+           strategy == CompileStrategy::kLazyBaselineEagerTopTier;
+  }
+
+  const WasmModule* const module_;
+  const ModuleWireBytes wire_bytes_;
+  const WasmFeatures enabled_features_;
+  const bool lazy_module_;
+  const OnlyLazyFunctions only_lazy_functions_;
+  Counters* const counters_;
+  AccountingAllocator* const allocator_;
+  std::atomic<int> next_function_;
+  FirstValidationError* const first_error_;
+};
+
+// Validates the functions of the module (skipping non-lazy functions if
+// requested) and records the first invalid one in {first_error}.
+void ValidateFunctionsInParallel(const WasmModule* module,
+                                 ModuleWireBytes wire_bytes,
+                                 WasmFeatures enabled_features,
+                                 bool lazy_module,
+                                 OnlyLazyFunctions only_lazy_functions,
+                                 Counters* counters,
+                                 AccountingAllocator* allocator,
+                                 FirstValidationError* first_error) {
+  TRACE_EVENT1(TRACE_DISABLED_BY_DEFAULT("v8.wasm.detailed"),
+               "wasm.ValidateFunctions", "num_functions",
+               module->num_declared_functions);
+  auto job = std::make_unique<ValidateFunctionsJob>(
+      module, wire_bytes, enabled_features, lazy_module, only_lazy_functions,
+      counters, allocator, first_error);
+  if (FLAG_wasm_num_compilation_tasks > 0) {
+    auto job_handle = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserBlocking, std::move(job));
+    // Wait for completion, while contributing to the work.
+    job_handle->Join();
+  } else {
+    job->Run(nullptr);
+  }
+}
+
+// Validates the functions of the module in parallel, and reports the error of
+// the first invalid function (if any) to the {thrower}.
+void ValidateFunctions(
     const WasmModule* module, NativeModule* native_module, Counters* counters,
     AccountingAllocator* allocator, ErrorThrower* thrower, bool lazy_module,
     OnlyLazyFunctions only_lazy_functions = kAllFunctions) {
   DCHECK(!thrower->error());
-  uint32_t start = module->num_imported_functions;
-  uint32_t end = start + module->num_declared_functions;
-  auto enabled_features = native_module->enabled_features();
-  for (uint32_t func_index = start; func_index < end; func_index++) {
-    // Skip non-lazy functions if requested.
-    if (only_lazy_functions) {
-      CompileStrategy strategy =
-          GetCompileStrategy(module, enabled_features, func_index, lazy_module);
-      if (strategy != CompileStrategy::kLazy &&
-          strategy != CompileStrategy::kLazyBaselineEagerTopTier) {
-        continue;
-      }
-    }
-
-    ModuleWireBytes wire_bytes{native_module->wire_bytes()};
-    const WasmFunction* func = &module->functions[func_index];
-    base::Vector<const uint8_t> code = wire_bytes.GetFunctionBytes(func);
-    DecodeResult result = ValidateSingleFunction(
-        module, func_index, code, counters, allocator, enabled_features);
-    if (result.failed()) {
-      SetCompileError(thrower, wire_bytes, func, module, result.error());
-    }
-  }
+  ModuleWireBytes wire_bytes{native_module->wire_bytes()};
+  FirstValidationError first_error(static_cast<int>(
+      module->num_imported_functions + module->num_declared_functions));
+  ValidateFunctionsInParallel(module, wire_bytes,
+                              native_module->enabled_features(), lazy_module,
+                              only_lazy_functions, counters, allocator,
+                              &first_error);
+  if (!first_error.has_error()) return;
+  const WasmFunction* func = &module->functions[first_error.func_index()];
+  SetCompileError(thrower, wire_bytes, func, module, first_error.error());
 }
 
 bool IsLazyModule(const WasmModule* module) {
@@ -1665,6 +1776,26 @@ bool MayCompriseLazyFunctions(const WasmModule* module,
   return false;
 }
 
+// Validates all functions which are compiled lazily, and returns the error of
+// the first invalid one (or an empty error).
+WasmError ValidateLazilyCompiledFunctions(const WasmModule* module,
+                                          ModuleWireBytes wire_bytes,
+                                          WasmFeatures enabled_features,
+                                          bool lazy_module, Counters* counters,
+                                          AccountingAllocator* allocator) {
+  if (FLAG_wasm_lazy_validation ||
+      !MayCompriseLazyFunctions(module, enabled_features, lazy_module)) {
+    return {};
+  }
+  FirstValidationError first_error(static_cast<int>(
+      module->num_imported_functions + module->num_declared_functions));
+  ValidateFunctionsInParallel(module, wire_bytes, enabled_features,
+                              lazy_module, kOnlyLazyFunctions, counters,
+                              allocator, &first_error);
+  if (!first_error.has_error()) return {};
+  return std::move(first_error.error());
+}
+
 class CompilationTimeCallback : public CompilationEventCallback {
  public:
   enum CompileMode { kSynchronous, kAsync, kStreaming };
@@ -1768,9 +1899,9 @@ void CompileNativeModule(Isolate* isolate,
     // Validate wasm modules for lazy compilation if requested. Never validate
     // asm.js modules as these are valid by construction (additionally a CHECK
     // will catch this during lazy compilation).
-    ValidateSequentially(wasm_module, native_module.get(), isolate->counters(),
-                         isolate->allocator(), thrower, lazy_module,
-                         kOnlyLazyFunctions);
+    ValidateFunctions(wasm_module, native_module.get(), isolate->counters(),
+                      isolate->allocator(), thrower, lazy_module,
+                      kOnlyLazyFunctions);
     // On error: Return and leave the module in an unexecutable state.
     if (thrower->error()) return;
   }
@@ -1795,8 +1926,8 @@ void CompileNativeModule(Isolate* isolate,
 
   if (compilation_state->failed()) {
     DCHECK_IMPLIES(lazy_module, !FLAG_wasm_lazy_validation);
-    ValidateSequentially(wasm_module, native_module.get(), isolate->counters(),
-                         isolate->allocator(), thrower, lazy_module);
+    ValidateFunctions(wasm_module, native_module.get(), isolate->counters(),
+                      isolate->allocator(), thrower, lazy_module);
     CHECK(thrower->error());
     return;
   }
@@ -1811,8 +1942,8 @@ void CompileNativeModule(Isolate* isolate,
 
   if (compilation_state->failed()) {
     DCHECK_IMPLIES(lazy_module, !FLAG_wasm_lazy_validation);
-    ValidateSequentially(wasm_module, native_module.get(), isolate->counters(),
-                         isolate->allocator(), thrower, lazy_module);
+    ValidateFunctions(wasm_module, native_module.get(), isolate->counters(),
+                      isolate->allocator(), thrower, lazy_module);
     CHECK(thrower->error());
   }
 }
@@ -1987,6 +2118,68 @@ void AsyncCompileJob::Abort() {
   GetWasmEngine()->RemoveCompileJob(this);
 }
 
+// Validates the bodies of lazily compiled functions while the module is still
+// being streamed. The streaming thread adds each function body when it arrives,
+// and workers validate them concurrently to the download.
+class StreamingValidationJob final : public JobTask {
+ public:
+  StreamingValidationJob(std::shared_ptr<const WasmModule> module,
+                         std::shared_ptr<WireBytesStorage> wire_bytes_storage,
+                         WasmFeatures enabled_features,
+                         std::shared_ptr<Counters> counters,
+                         AccountingAllocator* allocator,
+                         FirstValidationError* first_error)
+      : module_(std::move(module)),
+        wire_bytes_storage_(std::move(wire_bytes_storage)),
+        enabled_features_(enabled_features),
+        counters_(std::move(counters)),
+        allocator_(allocator),
+        first_error_(first_error) {}
+
+  // {code} must be owned by the {wire_bytes_storage}.
+  void AddFunction(int func_index, base::Vector<const uint8_t> code) {
+    base::MutexGuard guard(&mutex_);
+    queue_.emplace(func_index, code);
+  }
+
+  void Run(JobDelegate* delegate) override {
+    do {
+      std::pair<int, base::Vector<const uint8_t>> function;
+      {
+        base::MutexGuard guard(&mutex_);
+        if (queue_.empty()) return;
+        function = queue_.front();
+        queue_.pop();
+      }
+      // Skip functions after one which already failed validation.
+      if (function.first >= first_error_->func_index()) continue;
+      DecodeResult result = ValidateSingleFunction(
+          module_.get(), function.first, function.second, counters_.get(),
+          allocator_, enabled_features_);
+      if (result.failed()) {
+        first_error_->Record(function.first, std::move(result).error());
+      }
+    } while (!delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    DCHECK_GE(FLAG_wasm_num_compilation_tasks, 1);
+    base::MutexGuard guard(&mutex_);
+    return std::min(static_cast<size_t>(FLAG_wasm_num_compilation_tasks),
+                    queue_.size() + worker_count);
+  }
+
+ private:
+  const std::shared_ptr<const WasmModule> module_;
+  const std::shared_ptr<WireBytesStorage> wire_bytes_storage_;
+  const WasmFeatures enabled_features_;
+  const std::shared_ptr<Counters> counters_;
+  AccountingAllocator* const allocator_;
+  FirstValidationError* const first_error_;
+  mutable base::Mutex mutex_;
+  std::queue<std::pair<int, base::Vector<const uint8_t>>> queue_;
+};
+
 class AsyncStreamingProcessor final : public StreamingProcessor {
  public:
   explicit AsyncStreamingProcessor(AsyncCompileJob* job,
@@ -2028,6 +2221,11 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
 
   void CommitCompilationUnits();
 
+  // Waits for the validation of all function bodies received so far, and
+  // returns the error of the first invalid one (or an empty error).
+  WasmError FinishValidation();
+  void CancelValidation();
+
   ModuleDecoder decoder_;
   AsyncCompileJob* job_;
   std::unique_ptr<CompilationUnitBuilder> compilation_unit_builder_;
@@ -2037,6 +2235,11 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   std::shared_ptr<Counters> async_counters_;
   AccountingAllocator* allocator_;
 
+  // Validation of lazily compiled functions, see {StreamingValidationJob}.
+  std::unique_ptr<FirstValidationError> first_validation_error_;
+  StreamingValidationJob* validation_job_ = nullptr;
+  std::unique_ptr<JobHandle> validation_job_handle_;
+
   // Running hash of the wire bytes up to code section size, but excluding the
   // code section itself. Used by the {NativeModuleCache} to detect potential
   // duplicate modules.
@@ -2214,9 +2417,9 @@ void AsyncCompileJob::AsyncCompileFailed() {
   ErrorThrower thrower(isolate_, api_method_name_);
   DCHECK_EQ(native_module_->module()->origin, kWasmOrigin);
   const bool lazy_module = wasm_lazy_compilation_;
-  ValidateSequentially(native_module_->module(), native_module_.get(),
-                       isolate_->counters(), isolate_->allocator(), &thrower,
-                       lazy_module);
+  ValidateFunctions(native_module_->module(), native_module_.get(),
+                    isolate_->counters(), isolate_->allocator(), &thrower,
+                    lazy_module);
   DCHECK(thrower.error());
   // {job} keeps the {this} pointer alive.
   std::shared_ptr<AsyncCompileJob> job =
@@ -2449,36 +2652,14 @@ class AsyncCompileJob::DecodeModule : public AsyncCompileJob::CompileStep {
           DecodingMethod::kAsync, GetWasmEngine()->allocator());
 
       // Validate lazy functions here if requested.
-      if (!FLAG_wasm_lazy_validation && result.ok()) {
+      if (result.ok()) {
         const WasmModule* module = result.value().get();
         DCHECK_EQ(module->origin, kWasmOrigin);
-        const bool lazy_module = job->wasm_lazy_compilation_;
-        if (MayCompriseLazyFunctions(module, enabled_features, lazy_module)) {
-          auto allocator = GetWasmEngine()->allocator();
-          int start = module->num_imported_functions;
-          int end = start + module->num_declared_functions;
-
-          for (int func_index = start; func_index < end; func_index++) {
-            const WasmFunction* func = &module->functions[func_index];
-            base::Vector<const uint8_t> code =
-                job->wire_bytes_.GetFunctionBytes(func);
-
-            CompileStrategy strategy = GetCompileStrategy(
-                module, enabled_features, func_index, lazy_module);
-            bool validate_lazily_compiled_function =
-                strategy == CompileStrategy::kLazy ||
-                strategy == CompileStrategy::kLazyBaselineEagerTopTier;
-            if (validate_lazily_compiled_function) {
-              DecodeResult function_result =
-                  ValidateSingleFunction(module, func_index, code, counters_,
-                                         allocator, enabled_features);
-              if (function_result.failed()) {
-                result = ModuleResult(function_result.error());
-                break;
-              }
-            }
-          }
-        }
+        WasmError error = ValidateLazilyCompiledFunctions(
+            module, job->wire_bytes_, enabled_features,
+            job->wasm_lazy_compilation_, counters_,
+            GetWasmEngine()->allocator());
+        if (error.has_error()) result = ModuleResult(std::move(error));
       }
     }
     if (result.failed()) {
@@ -2658,6 +2839,7 @@ AsyncStreamingProcessor::AsyncStreamingProcessor(
       allocator_(allocator) {}
 
 AsyncStreamingProcessor::~AsyncStreamingProcessor() {
+  CancelValidation();
   if (job_->native_module_ && job_->native_module_->wire_bytes().empty()) {
     // Clean up the temporary cache entry.
     GetWasmEngine()->StreamingCompilationFailed(prefix_hash_);
@@ -2670,6 +2852,7 @@ void AsyncStreamingProcessor::FinishAsyncCompileJobWithError(
   // Make sure all background tasks stopped executing before we change the state
   // of the AsyncCompileJob to DecodeFail.
   job_->background_task_manager_.CancelAndWait();
+  CancelValidation();
 
   // Record event metrics.
   auto duration = base::TimeTicks::Now() - job_->start_time_;
@@ -2774,6 +2957,24 @@ bool AsyncStreamingProcessor::ProcessCodeSectionHeader(
   decoder_.set_code_section(code_section_start,
                             static_cast<uint32_t>(code_section_length));
 
+  // Start validating lazily compiled functions while their bodies arrive.
+  const WasmModule* module = decoder_.module();
+  if (!FLAG_wasm_lazy_validation &&
+      MayCompriseLazyFunctions(module, job_->enabled_features_,
+                               job_->wasm_lazy_compilation_)) {
+    first_validation_error_ = std::make_unique<FirstValidationError>(
+        static_cast<int>(module->num_imported_functions + num_functions));
+    if (FLAG_wasm_num_compilation_tasks > 0) {
+      auto validation_job = std::make_unique<StreamingValidationJob>(
+          decoder_.shared_module(), wire_bytes_storage,
+          job_->enabled_features_, async_counters_, allocator_,
+          first_validation_error_.get());
+      validation_job_ = validation_job.get();
+      validation_job_handle_ = V8::GetCurrentPlatform()->PostJob(
+          TaskPriority::kUserVisible, std::move(validation_job));
+    }
+  }
+
   prefix_hash_ = base::hash_combine(prefix_hash_,
                                     static_cast<uint32_t>(code_section_length));
   if (!GetWasmEngine()->GetStreamingCompilationOwnership(prefix_hash_)) {
@@ -2815,27 +3016,40 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(
   decoder_.DecodeFunctionBody(
       num_functions_, static_cast<uint32_t>(bytes.length()), offset, false);
 
-  const WasmModule* module = decoder_.module();
-  auto enabled_features = job_->enabled_features_;
   uint32_t func_index =
       num_functions_ + decoder_.module()->num_imported_functions;
+  const WasmModule* module = decoder_.module();
   DCHECK_EQ(module->origin, kWasmOrigin);
-  const bool lazy_module = job_->wasm_lazy_compilation_;
-  CompileStrategy strategy =
-      GetCompileStrategy(module, enabled_features, func_index, lazy_module);
-  bool validate_lazily_compiled_function =
-      !FLAG_wasm_lazy_validation &&
-      (strategy == CompileStrategy::kLazy ||
-       strategy == CompileStrategy::kLazyBaselineEagerTopTier);
-  if (validate_lazily_compiled_function) {
-    // The native module does not own the wire bytes until {SetWireBytes} is
-    // called in {OnFinishedStream}. Validation must use {bytes} parameter.
-    DecodeResult result =
-        ValidateSingleFunction(module, func_index, bytes, async_counters_.get(),
-                               allocator_, enabled_features);
-
-    if (result.failed()) {
-      FinishAsyncCompileJobWithError(result.error());
+  // Functions which are compiled lazily are validated by the
+  // {StreamingValidationJob} while the rest of the module is streamed. All
+  // other functions are validated as part of their compilation on the
+  // background threads.
+  if (first_validation_error_) {
+    CompileStrategy strategy =
+        GetCompileStrategy(module, job_->enabled_features_, func_index,
+                           job_->wasm_lazy_compilation_);
+    if (strategy == CompileStrategy::kLazy ||
+        strategy == CompileStrategy::kLazyBaselineEagerTopTier) {
+      if (validation_job_handle_) {
+        validation_job_->AddFunction(func_index, bytes);
+        validation_job_handle_->NotifyConcurrencyIncrease();
+      } else {
+        // Without background threads, validate right here.
+        DecodeResult result =
+            ValidateSingleFunction(module, func_index, bytes,
+                                   async_counters_.get(), allocator_,
+                                   job_->enabled_features_);
+        if (result.failed()) {
+          first_validation_error_->Record(func_index,
+                                          std::move(result).error());
+        }
+      }
+    }
+    // Stop streaming as soon as an invalid function was found. All functions
+    // with lower indexes have been received, so waiting for their validation
+    // yields the same error as validating the whole module.
+    if (first_validation_error_->has_error()) {
+      FinishAsyncCompileJobWithError(FinishValidation());
       return false;
     }
   }
@@ -2878,6 +3092,14 @@ void AsyncStreamingProcessor::OnFinishedStream(
   job_->wire_bytes_ = ModuleWireBytes(bytes.as_vector());
   job_->bytes_copy_ = bytes.ReleaseData();
 
+  // Wait for the remaining validation of lazily compiled functions, which
+  // already ran concurrently to streaming.
+  WasmError validation_error = FinishValidation();
+  if (validation_error.has_error()) {
+    FinishAsyncCompileJobWithError(validation_error);
+    return;
+  }
+
   // Record event metrics.
   auto duration = base::TimeTicks::Now() - job_->start_time_;
   job_->metrics_event_.success = true;
@@ -2940,6 +3162,29 @@ void AsyncStreamingProcessor::OnFinishedStream(
   }
 }
 
+WasmError AsyncStreamingProcessor::FinishValidation() {
+  if (!first_validation_error_) return {};
+  if (validation_job_handle_) {
+    // Contribute to the remaining work while waiting.
+    validation_job_handle_->Join();
+    validation_job_handle_.reset();
+    validation_job_ = nullptr;
+  }
+  std::unique_ptr<FirstValidationError> first_error =
+      std::move(first_validation_error_);
+  if (!first_error->has_error()) return {};
+  return std::move(first_error->error());
+}
+
+void AsyncStreamingProcessor::CancelValidation() {
+  if (validation_job_handle_) {
+    validation_job_handle_->Cancel();
+    validation_job_handle_.reset();
+    validation_job_ = nullptr;
+  }
+  first_validation_error_.reset();
+}
+
 // Report an error detected in the StreamingDecoder.
 void AsyncStreamingProcessor::OnError(const WasmError& error) {
   TRACE_STREAMING("Stream error...\n");
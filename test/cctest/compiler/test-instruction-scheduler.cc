@@ -50,6 +50,10 @@ class InstructionSchedulerTester {
              successors.end());
   }
 
+  void CheckRegisterPressureDelta(Instruction* instr, int expected) {
+    CHECK_EQ(expected, GetNode(instr)->RegisterPressureDelta());
+  }
+
   Zone* zone() { return scope_.main_zone(); }
 
  private:
@@ -107,6 +111,49 @@ TEST(DeoptInMiddleOfBasicBlock) {
   tester.EndBlock();
 }
 
+TEST(RegisterPressureDelta) {
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+
+  tester.StartBlock();
+  // v0 = producer()
+  InstructionOperand v0 =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0);
+  Instruction* producer = Instruction::New(zone, kArchNop, 1, &v0, 0, nullptr,
+                                           0, nullptr);
+  tester.AddInstruction(producer);
+  // v1 = first_use(v0)
+  InstructionOperand v1 =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1);
+  InstructionOperand first_use_inputs[] = {
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0)};
+  Instruction* first_use = Instruction::New(
+      zone, kArchNop, 1, &v1, arraysize(first_use_inputs), first_use_inputs,
+      0, nullptr);
+  tester.AddInstruction(first_use);
+  // last_use(v0, v1)
+  InstructionOperand last_use_inputs[] = {
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0),
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1)};
+  Instruction* last_use =
+      Instruction::New(zone, kArchNop, 0, nullptr, arraysize(last_use_inputs),
+                       last_use_inputs, 0, nullptr);
+  tester.AddInstruction(last_use);
+  Instruction* ret_inst = Instruction::New(zone, kArchRet);
+  tester.AddTerminator(ret_inst);
+
+  // Defining a value that is used later makes it live.
+  tester.CheckRegisterPressureDelta(producer, 1);
+  // v0 stays live as it has another use, v1 becomes live.
+  tester.CheckRegisterPressureDelta(first_use, 1);
+  // The deltas are computed before anything is scheduled. last_use ends the
+  // live range of v1, but first_use still counts as an unscheduled use of v0,
+  // so v0 is not counted as dying here.
+  tester.CheckRegisterPressureDelta(last_use, -1);
+
+  tester.EndBlock();
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
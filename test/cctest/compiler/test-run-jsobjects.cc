@@ -2,10 +2,13 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "include/v8-function.h"
 #include "src/execution/isolate.h"
 #include "src/heap/factory.h"
+#include "src/heap/heap-inl.h"
 #include "src/objects/objects-inl.h"
 #include "test/cctest/compiler/function-tester.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -52,6 +55,52 @@ TEST(ArgumentsRest) {
   CHECK_EQ(3, length->Number());
 }
 
+TEST(LoopPhiObjectIsScalarReplaced) {
+  if (!FLAG_opt || !FLAG_turbo_escape || FLAG_single_generation) return;
+  FlagScope<bool> allow_natives_syntax(&FLAG_allow_natives_syntax, true);
+  FlagScope<bool> always_opt(&FLAG_always_opt, false);
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Heap* heap = CcTest::heap();
+
+  // The accumulator is threaded through the loop phi by the reducer-style
+  // helper and never leaves {sum}.
+  v8::Local<v8::Value> sum = CompileRun(
+      "function add(acc, x, y) { acc.x += x; acc.y += y; return acc; }"
+      "function sum(points) {"
+      "  let acc = {x: 0, y: 0};"
+      "  for (let i = 0; i < points.length; i++) {"
+      "    const {x, y} = points[i];"
+      "    acc = add(acc, x, y);"
+      "  }"
+      "  return acc.x + acc.y;"
+      "}"
+      "var points = [];"
+      "for (let i = 0; i < 100; i++) points.push({x: i, y: 1});"
+      "%PrepareFunctionForOptimization(sum);"
+      "sum(points);"
+      "sum(points);"
+      "%OptimizeFunctionOnNextCall(sum);"
+      "sum(points);"
+      "sum");
+  Handle<JSFunction> function =
+      Handle<JSFunction>::cast(v8::Utils::OpenHandle(*sum));
+  CHECK(function->HasAttachedOptimizedCode());
+
+  v8::Local<v8::Context> context = CcTest::isolate()->GetCurrentContext();
+  v8::Local<v8::Value> argv[] = {CompileRun("points")};
+  size_t before = heap->NewSpaceAllocationCounter();
+  v8::Local<v8::Value> result =
+      sum.As<v8::Function>()
+          ->Call(context, v8::Undefined(CcTest::isolate()), 1, argv)
+          .ToLocalChecked();
+  size_t allocated = heap->NewSpaceAllocationCounter() - before;
+  CHECK_EQ(4950 + 100, result->Int32Value(context).FromJust());
+  CHECK(function->HasAttachedOptimizedCode());
+  // Not even the accumulator itself is allocated.
+  CHECK_LT(allocated, static_cast<size_t>(JSObject::kHeaderSize));
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
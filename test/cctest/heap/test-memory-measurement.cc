@@ -285,6 +285,26 @@ TEST(PartiallyInitializedContext) {
   isolate->RegisterDeserializerFinished();
 }
 
+TEST(ContinuousMemoryMeasurement) {
+  ManualGCScope manual_gc_scope;
+  LocalContext env;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  CompileRun("var retained = new Array(10000).fill(0);");
+  Heap* heap = CcTest::heap();
+  const int gc_count = heap->gc_count();
+  isolate->SetContinuousMemoryMeasurement(true);
+  // Enabling the measurement does not trigger a GC.
+  CHECK_EQ(gc_count, heap->gc_count());
+  size_t size = 0;
+  CHECK(!isolate->GetMeasuredContextMemory(env.local(), &size));
+  CcTest::CollectAllGarbage();
+  CHECK(isolate->GetMeasuredContextMemory(env.local(), &size));
+  CHECK_LE(10000 * kTaggedSize, size);
+  isolate->SetContinuousMemoryMeasurement(false);
+  CHECK(!isolate->GetMeasuredContextMemory(env.local(), &size));
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
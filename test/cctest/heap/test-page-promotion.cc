@@ -4,6 +4,8 @@
 
 #include "src/execution/isolate.h"
 #include "src/heap/factory.h"
+#include "src/heap/mark-compact.h"
+#include "src/heap/safepoint.h"
 #include "src/heap/spaces-inl.h"
 #include "src/objects/objects-inl.h"
 #include "test/cctest/cctest.h"
@@ -100,6 +102,93 @@ UNINITIALIZED_TEST(PagePromotion_NewToOld) {
   isolate->Dispose();
 }
 
+#ifdef ENABLE_MINOR_MC
+UNINITIALIZED_TEST(PagePromotion_MinorMCRefillsFreeList) {
+  if (i::FLAG_single_generation) return;
+  FLAG_minor_mc = true;
+  FLAG_minor_mc_sweep_promoted_pages = true;
+  FLAG_stress_concurrent_allocation = false;
+  ManualGCScope manual_gc_scope;
+
+  v8::Isolate* isolate = NewIsolateForPagePromotion();
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    Heap* heap = i_isolate->heap();
+
+    heap->CollectGarbage(NEW_SPACE, i::GarbageCollectionReason::kTesting);
+    heap->CollectGarbage(NEW_SPACE, i::GarbageCollectionReason::kTesting);
+
+    // Fill new space and keep only every other array alive, so that the
+    // promoted pages contain dead space.
+    Handle<FixedArray> holder;
+    {
+      HandleScope inner_scope(i_isolate);
+      std::vector<Handle<FixedArray>> handles;
+      heap::SimulateFullSpace(heap->new_space(), &handles);
+      CHECK_GT(handles.size(), 1u);
+      Handle<FixedArray> live = i_isolate->factory()->NewFixedArray(
+          static_cast<int>(handles.size()), AllocationType::kOld);
+      for (size_t i = 0; i < handles.size(); i += 2) {
+        live->set(static_cast<int>(i), *handles[i]);
+      }
+      holder = inner_scope.CloseAndEscape(live);
+    }
+    int last = (holder->length() - 1) & ~1;
+    Page* const page =
+        Page::FromHeapObject(HeapObject::cast(holder->get(last)));
+    CHECK(page->InNewSpace());
+    CHECK(!page->Contains(heap->new_space()->age_mark()));
+
+    // The page is moved within new space first and promoted by the next minor
+    // GC, unless it is already below the age mark.
+    for (int i = 0; i < 2 && page->InNewSpace(); ++i) {
+      heap->CollectGarbage(NEW_SPACE, i::GarbageCollectionReason::kTesting);
+    }
+    CHECK(heap->old_space()->ContainsSlow(page->address()));
+    CHECK_EQ(page, Page::FromHeapObject(HeapObject::cast(holder->get(last))));
+
+    // The dead space is on the old space free list right away, and the page
+    // and space counters agree.
+    CHECK_LT(page->allocated_bytes(), page->area_size());
+    CHECK_GT(page->AvailableInFreeList(), 0u);
+    {
+      SafepointScope scope(heap);
+      heap->mark_compact_collector()->EnsureSweepingCompleted();
+    }
+#ifdef DEBUG
+    heap->old_space()->VerifyCountersAfterSweeping(heap);
+#endif  // DEBUG
+#ifdef VERIFY_HEAP
+    heap->Verify();
+#endif  // VERIFY_HEAP
+
+    // Allocate from the free list of the promoted page only.
+    heap->old_space()->FreeLinearAllocationArea();
+    for (Page* p : *heap->old_space()) {
+      if (p != page) p->MarkNeverAllocateForTesting();
+    }
+    Handle<FixedArray> allocated =
+        i_isolate->factory()->NewFixedArray(128, AllocationType::kOld);
+    CHECK_EQ(page, Page::FromHeapObject(*allocated));
+    for (int i = 0; i < holder->length(); i += 2) {
+      CHECK(holder->get(i).IsFixedArray());
+    }
+#ifdef VERIFY_HEAP
+    heap->Verify();
+#endif  // VERIFY_HEAP
+
+    heap::GcAndSweep(heap, OLD_SPACE);
+#ifdef VERIFY_HEAP
+    heap->Verify();
+#endif  // VERIFY_HEAP
+  }
+  isolate->Dispose();
+}
+#endif  // ENABLE_MINOR_MC
+
 #endif  // V8_LITE_MODE
 
 }  // namespace heap
@@ -45,6 +45,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-tester.h"
 #include "test/cctest/heap/heap-utils.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -231,6 +232,54 @@ TEST(MemoryAllocator) {
   // OldSpace's destructor will tear down the space and free up all pages.
 }
 
+TEST(HugePagePool) {
+  FlagScope<bool> huge_page_pool_scope(&FLAG_huge_page_pool, true);
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+
+  TestMemoryAllocatorScope test_allocator_scope(isolate, heap->MaxReserved());
+  MemoryAllocator* memory_allocator = test_allocator_scope.allocator();
+  MemoryAllocator::HugePagePool* pool = memory_allocator->huge_page_pool();
+  LinearAllocationArea allocation_info;
+  OldSpace faked_space(heap, &allocation_info);
+
+  Page* first_page = memory_allocator->AllocatePage(
+      MemoryAllocator::kRegular, faked_space.AreaSize(),
+      static_cast<PagedSpace*>(&faked_space), NOT_EXECUTABLE);
+  faked_space.memory_chunk_list().PushBack(first_page);
+  Page* second_page = memory_allocator->AllocatePage(
+      MemoryAllocator::kRegular, faked_space.AreaSize(),
+      static_cast<PagedSpace*>(&faked_space), NOT_EXECUTABLE);
+  faked_space.memory_chunk_list().PushBack(second_page);
+
+  // Both pages are carved out of the same region.
+  CHECK(pool->Contains(first_page->address()));
+  CHECK(pool->Contains(second_page->address()));
+  CHECK_EQ(RoundDown(first_page->address(),
+                     MemoryAllocator::HugePagePool::kRegionSize),
+           RoundDown(second_page->address(),
+                     MemoryAllocator::HugePagePool::kRegionSize));
+  CHECK(!first_page->reserved_memory()->IsReserved());
+  const size_t free_memory = pool->CommittedFreeMemory();
+  CHECK_EQ((MemoryAllocator::HugePagePool::kPagesPerRegion - 2) *
+               MemoryChunk::kPageSize,
+           free_memory);
+
+  // A freed page goes back to the pool and is handed out again.
+  const Address second_page_address = second_page->address();
+  faked_space.memory_chunk_list().Remove(second_page);
+  memory_allocator->Free(MemoryAllocator::kImmediately, second_page);
+  CHECK_EQ(free_memory + MemoryChunk::kPageSize, pool->CommittedFreeMemory());
+  Page* third_page = memory_allocator->AllocatePage(
+      MemoryAllocator::kRegular, faked_space.AreaSize(),
+      static_cast<PagedSpace*>(&faked_space), NOT_EXECUTABLE);
+  faked_space.memory_chunk_list().PushBack(third_page);
+  CHECK_EQ(second_page_address, third_page->address());
+  CHECK_EQ(free_memory, pool->CommittedFreeMemory());
+
+  // OldSpace's destructor will tear down the space and free up all pages.
+}
+
 TEST(ComputeDiscardMemoryAreas) {
   base::AddressRegion memory_area;
   size_t page_size = MemoryAllocator::GetCommitPageSize();
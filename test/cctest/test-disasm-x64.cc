@@ -1364,6 +1364,8 @@ UNINITIALIZED_TEST(DisasmX64CheckOutputAVX) {
           vpshufd(xmm1, xmm2, 85));
   COMPARE("c5f9708c8b1027000055 vpshufd xmm1,[rbx+rcx*4+0x2710],0x55",
           vpshufd(xmm1, Operand(rbx, rcx, times_4, 10000), 85));
+  COMPARE("c5f173da04           vpsrldq xmm1,xmm2,4",
+          vpsrldq(xmm1, xmm2, 4));
   COMPARE("c5fb70ca55           vpshuflw xmm1,xmm2,0x55",
           vpshuflw(xmm1, xmm2, 85));
   COMPARE("c5fb708c8b1027000055 vpshuflw xmm1,[rbx+rcx*4+0x2710],0x55",
@@ -1230,6 +1230,70 @@ TEST(HeapSnapshotJSONSerializationAborting) {
   CHECK_EQ(0, stream.eos_signaled());
 }
 
+TEST(StreamingHeapSnapshot) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A() {}\n"
+      "var a = new A();\n"
+      "a.streamed_property = [1, 2, 3];");
+  const int snapshot_count = heap_profiler->GetSnapshotCount();
+
+  TestJSONStream stream;
+  CHECK(heap_profiler->TakeStreamingHeapSnapshot(&stream));
+  CHECK_EQ(1, stream.eos_signaled());
+  CHECK_EQ(snapshot_count, heap_profiler->GetSnapshotCount());
+  v8::base::ScopedVector<char> output(stream.size());
+  stream.WriteTo(output);
+  OneByteResource* output_resource = new OneByteResource(output);
+  env->Global()
+      ->Set(env.local(), v8_str("streamed_snapshot"),
+            v8::String::NewExternalOneByte(env->GetIsolate(), output_resource)
+                .ToLocalChecked())
+      .FromJust();
+
+  // Every line is valid JSON, strings are defined before they are used, and
+  // the edges match the edge counts and ids of the nodes.
+  v8::Local<v8::Value> result = CompileRun(
+      "var lines = streamed_snapshot.split('\\n').filter(l => l.length);\n"
+      "var header = JSON.parse(lines[0]);\n"
+      "var strings = new Map(), nodes = new Map(), edges = [];\n"
+      "for (var i = 1; i < lines.length; ++i) {\n"
+      "  var r = JSON.parse(lines[i]);\n"
+      "  var type = header.record_types[r[0]];\n"
+      "  if (type === 'string') strings.set(r[1], r[2]);\n"
+      "  if (type === 'node') {\n"
+      "    if (!strings.has(r[2])) throw 'undefined node name';\n"
+      "    nodes.set(r[3], r);\n"
+      "  }\n"
+      "  if (type === 'edge') edges.push(r);\n"
+      "}\n"
+      "var edge_count = 0;\n"
+      "nodes.forEach(n => edge_count += n[5]);\n"
+      "if (edge_count !== edges.length) throw 'edge count mismatch';\n"
+      "var found = false;\n"
+      "for (var e of edges) {\n"
+      "  if (!nodes.has(e[1]) || !nodes.has(e[4])) throw 'unknown node';\n"
+      "  if (header.edge_types[e[2]] === 'property' &&\n"
+      "      strings.get(e[3]) === 'streamed_property') {\n"
+      "    found = header.node_types[nodes.get(e[4])[1]] === 'array';\n"
+      "  }\n"
+      "}\n"
+      "found;");
+  CHECK(result->IsTrue());
+}
+
+TEST(StreamingHeapSnapshotAborting) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  TestJSONStream stream(5);
+  CHECK(!heap_profiler->TakeStreamingHeapSnapshot(&stream));
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(0, stream.eos_signaled());
+}
+
 namespace {
 
 class TestStatsStream : public v8::OutputStream {
@@ -5,7 +5,11 @@
 #include "src/common/globals.h"
 #include "src/execution/isolate-inl.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/read-only-heap-inl.h"
+#include "src/init/isolate-allocator.h"
+#include "src/sandbox/sandbox.h"
 #include "test/cctest/cctest.h"
+#include "test/common/flag-utils.h"
 
 #ifdef V8_COMPRESS_POINTERS
 
@@ -167,6 +171,163 @@ UNINITIALIZED_TEST(SharedPtrComprCageImpliesSharedReadOnlyHeap) {
   isolate2->Dispose();
 }
 #endif  // V8_SHARED_RO_HEAP
+
+namespace {
+bool CanUseSeveralSharedPtrComprCages() {
+#ifdef V8_SANDBOX
+  // The sandbox only holds a single pointer compression cage.
+  if (!GetProcessWideSandbox()->is_disabled()) return false;
+#endif
+  return true;
+}
+}  // namespace
+
+UNINITIALIZED_TEST(SharedPtrComprCagesDistributeIsolates) {
+  if (!CanUseSeveralSharedPtrComprCages()) return;
+  FlagScope<int> cages(&FLAG_shared_ptr_compr_cages, 2);
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  Isolate* i_isolate1 = reinterpret_cast<Isolate*>(isolate1);
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+
+  CHECK_NE(i_isolate1->cage_base(), i_isolate2->cage_base());
+  CHECK_EQ(0, IsolateAllocator::GetSharedPtrComprCageIndex(
+                  i_isolate1->cage_base()));
+  CHECK_EQ(1, IsolateAllocator::GetSharedPtrComprCageIndex(
+                  i_isolate2->cage_base()));
+  CHECK_EQ(-1, IsolateAllocator::GetSharedPtrComprCageIndex(kNullAddress));
+
+  {
+    HandleScope scope1(i_isolate1);
+    HandleScope scope2(i_isolate2);
+
+    Handle<FixedArray> isolate1_object =
+        i_isolate1->factory()->NewFixedArray(1);
+    Handle<FixedArray> isolate2_object =
+        i_isolate2->factory()->NewFixedArray(1);
+    CHECK_EQ(i_isolate1->cage_base(),
+             GetPtrComprCageBaseAddress(isolate1_object->ptr()));
+    CHECK_EQ(i_isolate2->cage_base(),
+             GetPtrComprCageBaseAddress(isolate2_object->ptr()));
+  }
+
+  isolate1->Dispose();
+  isolate2->Dispose();
+}
+
+#ifdef V8_SHARED_RO_HEAP
+UNINITIALIZED_TEST(SharedPtrComprCagesHaveOwnReadOnlyRoots) {
+  if (!CanUseSeveralSharedPtrComprCages()) return;
+  FlagScope<int> cages(&FLAG_shared_ptr_compr_cages, 2);
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  Isolate* i_isolate1 = reinterpret_cast<Isolate*>(isolate1);
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  CHECK_NE(i_isolate1->read_only_heap(), i_isolate2->read_only_heap());
+
+  {
+    HandleScope scope1(i_isolate1);
+    HandleScope scope2(i_isolate2);
+
+    // The roots of an object are found through the cage it lives in.
+    Handle<FixedArray> isolate1_object =
+        i_isolate1->factory()->NewFixedArray(1);
+    Handle<FixedArray> isolate2_object =
+        i_isolate2->factory()->NewFixedArray(1);
+    ReadOnlyRoots roots1 = ReadOnlyHeap::GetReadOnlyRoots(*isolate1_object);
+    ReadOnlyRoots roots2 = ReadOnlyHeap::GetReadOnlyRoots(*isolate2_object);
+    CHECK_EQ(ReadOnlyRoots(i_isolate1).the_hole_value(),
+             roots1.the_hole_value());
+    CHECK_EQ(ReadOnlyRoots(i_isolate2).the_hole_value(),
+             roots2.the_hole_value());
+    CHECK_NE(roots1.the_hole_value(), roots2.the_hole_value());
+    CHECK_EQ(roots1.fixed_array_map(), isolate1_object->map());
+    CHECK_EQ(roots2.fixed_array_map(), isolate2_object->map());
+  }
+
+  isolate1->Dispose();
+  isolate2->Dispose();
+}
+#endif  // V8_SHARED_RO_HEAP
+
+UNINITIALIZED_TEST(SharedPtrComprCagesExhausted) {
+  if (!CanUseSeveralSharedPtrComprCages()) return;
+  FlagScope<int> cages(&FLAG_shared_ptr_compr_cages, 2);
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  Isolate* i_isolate1 = reinterpret_cast<Isolate*>(isolate1);
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  // All cages are in use, so the next Isolate shares the least loaded one.
+  v8::Isolate* isolate3 = v8::Isolate::New(create_params);
+  Isolate* i_isolate3 = reinterpret_cast<Isolate*>(isolate3);
+  CHECK_NE(i_isolate1->cage_base(), i_isolate2->cage_base());
+  CHECK_EQ(i_isolate1->cage_base(), i_isolate3->cage_base());
+
+  // Disposing an Isolate makes its cage the least loaded one.
+  isolate2->Dispose();
+  v8::Isolate* isolate4 = v8::Isolate::New(create_params);
+  Isolate* i_isolate4 = reinterpret_cast<Isolate*>(isolate4);
+  CHECK_NE(i_isolate1->cage_base(), i_isolate4->cage_base());
+
+  isolate1->Dispose();
+  isolate3->Dispose();
+  isolate4->Dispose();
+}
+
+UNINITIALIZED_TEST(SharedPtrComprCageReservationFallback) {
+  if (!CanUseSeveralSharedPtrComprCages()) return;
+  FlagScope<int> cages(&FLAG_shared_ptr_compr_cages, 2);
+  IsolateAllocator::SetSharedPtrComprCageReservationFailsForTesting(true);
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // The second cage cannot be reserved, so both Isolates use the first one.
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  Isolate* i_isolate1 = reinterpret_cast<Isolate*>(isolate1);
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  CHECK_EQ(i_isolate1->cage_base(), i_isolate2->cage_base());
+  IsolateAllocator::SetSharedPtrComprCageReservationFailsForTesting(false);
+
+  isolate1->Dispose();
+  isolate2->Dispose();
+}
+
+UNINITIALIZED_TEST(SharedPtrComprCagesKeepClientsInSharedIsolateCage) {
+  if (!CanUseSeveralSharedPtrComprCages()) return;
+  if (FLAG_single_generation) return;
+  if (!ReadOnlyHeap::IsReadOnlySpaceShared()) return;
+  FlagScope<int> cages(&FLAG_shared_ptr_compr_cages, 2);
+  FlagScope<bool> shared_string_table(&FLAG_shared_string_table, true);
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  Isolate* shared_isolate = Isolate::NewShared(create_params);
+
+  // Isolates are placed into the cage of the shared Isolate on allocation,
+  // before it is known whether they attach to it.
+  create_params.experimental_attach_to_shared_isolate =
+      reinterpret_cast<v8::Isolate*>(shared_isolate);
+  v8::Isolate* isolate1 = v8::Isolate::Allocate();
+  v8::Isolate::Initialize(isolate1, create_params);
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  CHECK_EQ(shared_isolate->cage_base(),
+           reinterpret_cast<Isolate*>(isolate1)->cage_base());
+  CHECK_EQ(shared_isolate->cage_base(),
+           reinterpret_cast<Isolate*>(isolate2)->cage_base());
+
+  isolate1->Dispose();
+  isolate2->Dispose();
+  Isolate::Delete(shared_isolate);
+}
 #endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
 
 }  // namespace internal
@@ -66,6 +66,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 #include "test/cctest/setup-isolate-for-tests.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -1541,6 +1542,60 @@ UNINITIALIZED_TEST(CustomSnapshotDataBlobWithWarmup) {
   FreeCurrentEmbeddedBlob();
 }
 
+bool IsKnownHot(const char* name) {
+  return i::Handle<i::JSFunction>::cast(
+             v8::Utils::OpenHandle(*CompileRun(name)))
+      ->shared()
+      .is_known_hot();
+}
+
+UNINITIALIZED_TEST(CustomSnapshotDataBlobWithWarmupTieringHints) {
+  if (!FLAG_opt) return;
+  DisableAlwaysOpt();
+  FLAG_allow_natives_syntax = true;
+  FLAG_snapshot_tiering_hints = true;
+  const char* source =
+      "function f() { return Math.abs(1); }\n"
+      "function g() { return String.raw(1); }\n"
+      "var a = 5";
+  const char* warmup =
+      "%PrepareFunctionForOptimization(f);"
+      "f();"
+      "%OptimizeFunctionOnNextCall(f);"
+      "a = f() + g()";
+
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData cold = CreateSnapshotDataBlob(source);
+  v8::StartupData warm = WarmUpSnapshotDataBlobInternal(cold, warmup);
+  delete[] cold.data;
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &warm;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // Test-appropriate equivalent of v8::Isolate::New.
+  v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope c_scope(context);
+    // Only the function that got optimized during the warm-up carries the
+    // hint, its optimized code is not part of the snapshot.
+    CHECK(IsKnownHot("f"));
+    CHECK(!IsKnownHot("g"));
+    CHECK(IsCompiled("g"));
+    CHECK(!i::Handle<i::JSFunction>::cast(
+               v8::Utils::OpenHandle(*CompileRun("f")))
+               ->HasAttachedOptimizedCode());
+    CHECK_EQ(5, CompileRun("a")->Int32Value(context).FromJust());
+  }
+  isolate->Dispose();
+  delete[] warm.data;
+  FreeCurrentEmbeddedBlob();
+  FLAG_snapshot_tiering_hints = false;
+}
+
 namespace {
 v8::StartupData CreateCustomSnapshotWithKeep() {
   v8::SnapshotCreator creator;
@@ -2689,6 +2744,160 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+TEST(CodeSerializerTieringHints) {
+  if (!FLAG_opt || FLAG_always_opt) return;
+  FlagScope<bool> allow_natives_syntax(&FLAG_allow_natives_syntax, true);
+  FlagScope<bool> tiering_hints(&FLAG_code_cache_tiering_hints, true);
+  FlagList::EnforceFlagImplications();
+  const char* js_source =
+      "function f() { return 'abc'; };"
+      "function g() { return 'def'; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f();"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f() + g()";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // Only the function that got optimized in the first isolate carries the
+    // hint.
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    Handle<Script> i_script(Script::cast(toplevel->script()), i_isolate2);
+    int functions_found = 0;
+    SharedFunctionInfo::ScriptIterator iter(i_isolate2, *i_script);
+    for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      std::unique_ptr<char[]> name = info.DebugNameCStr();
+      if (strcmp(name.get(), "f") == 0) {
+        CHECK(info.is_known_hot());
+        functions_found++;
+      } else if (strcmp(name.get(), "g") == 0) {
+        CHECK(!info.is_known_hot());
+        functions_found++;
+      }
+    }
+    CHECK_EQ(2, functions_found);
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerTieringHintsTierUpEarly) {
+  if (!FLAG_opt || FLAG_always_opt) return;
+  FlagScope<bool> allow_natives_syntax(&FLAG_allow_natives_syntax, true);
+  FlagScope<bool> tiering_hints(&FLAG_code_cache_tiering_hints, true);
+  FlagScope<bool> concurrent_recompilation(&FLAG_concurrent_recompilation,
+                                           false);
+  // Neither function collects enough ticks below to be optimized without the
+  // hint, and neither counts as small enough for early optimization.
+  FlagScope<int> ticks_before_optimization(&FLAG_ticks_before_optimization,
+                                           1000);
+  FlagScope<int> max_bytecode_size_for_early_opt(
+      &FLAG_max_bytecode_size_for_early_opt, 0);
+  FlagScope<int> interrupt_budget(&FLAG_interrupt_budget, 1 * KB);
+  FlagList::EnforceFlagImplications();
+  const char* js_source =
+      "function f(x) { return x + 1; };"
+      "function g(x) { return x + 1; };";
+
+  v8::ScriptCompiler::CachedData* cache;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate1, v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CompileRun(
+        "%PrepareFunctionForOptimization(f);"
+        "f(1);"
+        "%OptimizeFunctionOnNextCall(f);"
+        "f(2);");
+    cache = ScriptCompiler::CreateCodeCache(script);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    // Both functions get the same ticks, but only the one that was hot in the
+    // run producing the cache is optimized after its first tick.
+    CompileRun("for (let i = 0; i < 10000; i++) { f(i); g(i); }");
+    Handle<JSFunction> f = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("f")));
+    Handle<JSFunction> g = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("g")));
+    CHECK(f->shared().is_known_hot());
+    CHECK(f->HasAttachedOptimizedCode());
+    CHECK(!g->HasAttachedOptimizedCode());
+  }
+  isolate2->Dispose();
+}
+
+TEST(TieringHintDroppedOnDeopt) {
+  if (!FLAG_opt || FLAG_always_opt) return;
+  FlagScope<bool> allow_natives_syntax(&FLAG_allow_natives_syntax, true);
+  FlagScope<bool> tiering_hints(&FLAG_code_cache_tiering_hints, true);
+  FlagList::EnforceFlagImplications();
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  CompileRun(
+      "function f(x) { return x + 1; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f(1);"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f(2);");
+  Handle<JSFunction> f = Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*CompileRun("f")));
+  CHECK(f->HasAttachedOptimizedCode());
+  CHECK(f->shared().is_known_hot());
+
+  // The eager deopt drops the hint, so that the function is not optimized
+  // again after a single tick.
+  CompileRun("f('a');");
+  CHECK(!f->HasAttachedOptimizedCode());
+  CHECK(!f->shared().is_known_hot());
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
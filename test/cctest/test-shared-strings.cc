@@ -2,11 +2,14 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
+
 #include "include/v8-initialization.h"
 #include "src/base/strings.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/string-table.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 
@@ -364,6 +367,259 @@ UNINITIALIZED_TEST(ConcurrentInternalizationHit) {
   TestConcurrentInternalization(kTestHit);
 }
 
+namespace {
+class ConcurrentGrowingInternalizationThread final : public v8::base::Thread {
+ public:
+  ConcurrentGrowingInternalizationThread(MultiClientIsolateTest* test,
+                                         int strings,
+                                         base::Semaphore* sema_ready,
+                                         base::Semaphore* sema_execute_start,
+                                         base::Semaphore* sema_execute_complete,
+                                         base::Semaphore* sema_teardown)
+      : v8::base::Thread(base::Thread::Options(
+            "ConcurrentGrowingInternalizationThread")),
+        test_(test),
+        strings_(strings),
+        sema_ready_(sema_ready),
+        sema_execute_start_(sema_execute_start),
+        sema_execute_complete_(sema_execute_complete),
+        sema_teardown_(sema_teardown) {}
+
+  void Run() override {
+    v8::Isolate* isolate = test_->NewClientIsolate();
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+    Factory* factory = i_isolate->factory();
+
+    sema_ready_->Signal();
+    sema_execute_start_->Wait();
+
+    // Keep all internalized strings alive until the main thread has counted
+    // the string table elements.
+    HandleScope scope(i_isolate);
+    for (int i = 0; i < strings_; i++) {
+      base::ScopedVector<char> buffer(32);
+      base::SNPrintF(buffer, "key-%d", i);
+      Handle<String> interned = factory->InternalizeString(
+          factory->NewStringFromAsciiChecked(buffer.begin()));
+      CHECK(interned->IsShared());
+      CHECK(interned->IsInternalizedString());
+    }
+
+    sema_execute_complete_->Signal();
+    sema_teardown_->Wait();
+  }
+
+ private:
+  MultiClientIsolateTest* test_;
+  int strings_;
+  base::Semaphore* sema_ready_;
+  base::Semaphore* sema_execute_start_;
+  base::Semaphore* sema_execute_complete_;
+  base::Semaphore* sema_teardown_;
+};
+}  // namespace
+
+UNINITIALIZED_TEST(ConcurrentInternalizationWithResize) {
+  if (!ReadOnlyHeap::IsReadOnlySpaceShared()) return;
+  if (!COMPRESS_POINTERS_IN_SHARED_CAGE_BOOL) return;
+
+  FLAG_shared_string_table = true;
+
+  MultiClientIsolateTest test;
+
+  constexpr int kThreads = 4;
+  // Enough strings to grow the string table several times while the threads
+  // are inserting into it.
+  constexpr int kStrings = 32768;
+
+  StringTable* string_table = test.i_shared_isolate()->string_table();
+
+  base::Semaphore sema_ready(0);
+  base::Semaphore sema_execute_start(0);
+  base::Semaphore sema_execute_complete(0);
+  base::Semaphore sema_teardown(0);
+  std::vector<std::unique_ptr<ConcurrentGrowingInternalizationThread>> threads;
+  for (int i = 0; i < kThreads; i++) {
+    auto thread = std::make_unique<ConcurrentGrowingInternalizationThread>(
+        &test, kStrings, &sema_ready, &sema_execute_start,
+        &sema_execute_complete, &sema_teardown);
+    CHECK(thread->Start());
+    threads.push_back(std::move(thread));
+  }
+
+  for (int i = 0; i < kThreads; i++) sema_ready.Wait();
+  int elements_before = string_table->NumberOfElements();
+  for (int i = 0; i < kThreads; i++) sema_execute_start.Signal();
+  for (int i = 0; i < kThreads; i++) sema_execute_complete.Wait();
+
+  // Every string was internalized exactly once, regardless of the number of
+  // threads that raced on inserting it.
+  CHECK_EQ(elements_before + kStrings, string_table->NumberOfElements());
+  CHECK_LT(kStrings, string_table->Capacity());
+
+  for (int i = 0; i < kThreads; i++) sema_teardown.Signal();
+  for (auto& thread : threads) {
+    thread->Join();
+  }
+}
+
+namespace {
+class ExistingLookupThread final : public v8::base::Thread {
+ public:
+  ExistingLookupThread(MultiClientIsolateTest* test, int strings,
+                       std::atomic<bool>* done, base::Semaphore* sema_ready,
+                       base::Semaphore* sema_execute_start,
+                       base::Semaphore* sema_execute_complete)
+      : v8::base::Thread(base::Thread::Options("ExistingLookupThread")),
+        test_(test),
+        strings_(strings),
+        done_(done),
+        sema_ready_(sema_ready),
+        sema_execute_start_(sema_execute_start),
+        sema_execute_complete_(sema_execute_complete) {}
+
+  void Run() override {
+    v8::Isolate* isolate = test_->NewClientIsolate();
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+    Factory* factory = i_isolate->factory();
+
+    sema_ready_->Signal();
+    sema_execute_start_->Wait();
+
+    // Look up the live strings until the other thread stopped resizing the
+    // table. A lookup must never miss a string that is in the table.
+    do {
+      for (int i = 0; i < strings_; i++) {
+        HandleScope scope(i_isolate);
+        base::ScopedVector<char> buffer(32);
+        base::SNPrintF(buffer, "live-%d", i);
+        Handle<String> copy =
+            factory->NewStringFromAsciiChecked(buffer.begin());
+        Address result = StringTable::TryStringToIndexOrLookupExisting(
+            i_isolate, copy->ptr());
+        CHECK_NE(Smi::FromInt(ResultSentinel::kNotFound).ptr(), result);
+        CHECK(String::cast(Object(result)).IsInternalizedString());
+      }
+    } while (!done_->load(std::memory_order_relaxed));
+
+    sema_execute_complete_->Signal();
+  }
+
+ private:
+  MultiClientIsolateTest* test_;
+  int strings_;
+  std::atomic<bool>* done_;
+  base::Semaphore* sema_ready_;
+  base::Semaphore* sema_execute_start_;
+  base::Semaphore* sema_execute_complete_;
+};
+
+class ResizingThread final : public v8::base::Thread {
+ public:
+  ResizingThread(MultiClientIsolateTest* test, int strings,
+                 std::atomic<bool>* done, base::Semaphore* sema_ready,
+                 base::Semaphore* sema_execute_start,
+                 base::Semaphore* sema_execute_complete)
+      : v8::base::Thread(base::Thread::Options("ResizingThread")),
+        test_(test),
+        strings_(strings),
+        done_(done),
+        sema_ready_(sema_ready),
+        sema_execute_start_(sema_execute_start),
+        sema_execute_complete_(sema_execute_complete) {}
+
+  void Run() override {
+    v8::Isolate* isolate = test_->NewClientIsolate();
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+    Factory* factory = i_isolate->factory();
+
+    sema_ready_->Signal();
+    sema_execute_start_->Wait();
+
+    HandleScope scope(i_isolate);
+    for (int i = 0; i < strings_; i++) {
+      base::ScopedVector<char> buffer(32);
+      base::SNPrintF(buffer, "grow-%d", i);
+      factory->InternalizeString(
+          factory->NewStringFromAsciiChecked(buffer.begin()));
+    }
+    done_->store(true, std::memory_order_relaxed);
+
+    sema_execute_complete_->Signal();
+  }
+
+ private:
+  MultiClientIsolateTest* test_;
+  int strings_;
+  std::atomic<bool>* done_;
+  base::Semaphore* sema_ready_;
+  base::Semaphore* sema_execute_start_;
+  base::Semaphore* sema_execute_complete_;
+};
+}  // namespace
+
+UNINITIALIZED_TEST(LookupExistingDuringResize) {
+  if (!ReadOnlyHeap::IsReadOnlySpaceShared()) return;
+  if (!COMPRESS_POINTERS_IN_SHARED_CAGE_BOOL) return;
+
+  FLAG_shared_string_table = true;
+
+  MultiClientIsolateTest test;
+
+  constexpr int kDeadStrings = 2048;
+  constexpr int kLiveStrings = 2048;
+  // Enough strings to grow the string table several times while the lookups
+  // are running.
+  constexpr int kGrowStrings = 32768;
+
+  v8::Isolate* isolate = test.NewClientIsolate();
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  Factory* factory = i_isolate->factory();
+
+  // Strings that die leave deleted entries in the probe sequences of the
+  // live strings that are inserted after them.
+  {
+    HandleScope scope(i_isolate);
+    for (int i = 0; i < kDeadStrings; i++) {
+      base::ScopedVector<char> buffer(32);
+      base::SNPrintF(buffer, "dead-%d", i);
+      factory->InternalizeString(
+          factory->NewStringFromAsciiChecked(buffer.begin()));
+    }
+  }
+  i_isolate->heap()->CollectSharedGarbage(GarbageCollectionReason::kTesting);
+
+  HandleScope scope(i_isolate);
+  Handle<FixedArray> live_strings =
+      factory->NewFixedArray(kLiveStrings, AllocationType::kOld);
+  for (int i = 0; i < kLiveStrings; i++) {
+    base::ScopedVector<char> buffer(32);
+    base::SNPrintF(buffer, "live-%d", i);
+    Handle<String> string = factory->InternalizeString(
+        factory->NewStringFromAsciiChecked(buffer.begin()));
+    live_strings->set(i, *string);
+  }
+
+  std::atomic<bool> done{false};
+  base::Semaphore sema_ready(0);
+  base::Semaphore sema_execute_start(0);
+  base::Semaphore sema_execute_complete(0);
+  ExistingLookupThread lookup_thread(&test, kLiveStrings, &done, &sema_ready,
+                                     &sema_execute_start,
+                                     &sema_execute_complete);
+  ResizingThread resizing_thread(&test, kGrowStrings, &done, &sema_ready,
+                                 &sema_execute_start, &sema_execute_complete);
+  CHECK(lookup_thread.Start());
+  CHECK(resizing_thread.Start());
+
+  for (int i = 0; i < 2; i++) sema_ready.Wait();
+  for (int i = 0; i < 2; i++) sema_execute_start.Signal();
+  for (int i = 0; i < 2; i++) sema_execute_complete.Wait();
+
+  lookup_thread.Join();
+  resizing_thread.Join();
+}
+
 namespace {
 void CheckSharedStringIsEqualCopy(Handle<String> shared,
                                   Handle<String> original) {
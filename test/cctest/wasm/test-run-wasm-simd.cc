@@ -2572,6 +2572,28 @@ WASM_SIMD_TEST(ShuffleShufps) {
   }
 }
 
+// Test splats of every 8- and 16-bit lane of both inputs. On hosts with AVX2
+// (--enable-avx2, which is on by default), TurboFan lowers these to vpsrldq
+// and vpbroadcast{b,w}.
+WASM_SIMD_TEST(S8x16DupAllLanes) {
+  std::array<int8_t, kSimd128Size> expected;
+  for (int lane = 0; lane < 2 * kSimd128Size; ++lane) {
+    expected.fill(lane);
+    RunShuffleOpTest(execution_tier, kExprI8x16Shuffle, expected);
+  }
+}
+
+WASM_SIMD_TEST(S16x8DupAllLanes) {
+  std::array<int8_t, kSimd128Size> expected;
+  for (int lane = 0; lane < kSimd128Size; ++lane) {
+    for (int i = 0; i < kSimd128Size; i += 2) {
+      expected[i] = 2 * lane;
+      expected[i + 1] = 2 * lane + 1;
+    }
+    RunShuffleOpTest(execution_tier, kExprI8x16Shuffle, expected);
+  }
+}
+
 struct SwizzleTestArgs {
   const Shuffle input;
   const Shuffle indices;
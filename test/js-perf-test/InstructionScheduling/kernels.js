@@ -0,0 +1,102 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Optimized loops with long basic blocks of independent arithmetic and
+// memory operations, where the order of instructions within a block decides
+// how much latency is hidden. Run once with the default flags and once with
+// --turbo-instruction-scheduling to decide where the scheduler pays off.
+
+new BenchmarkSuite('Polynomial', [1000], [
+  new Benchmark('Polynomial', false, false, 0, Polynomial, Setup, TearDown)
+]);
+
+new BenchmarkSuite('MatrixMultiply', [1000], [
+  new Benchmark('MatrixMultiply', false, false, 0, MatrixMultiply, Setup,
+                TearDown)
+]);
+
+new BenchmarkSuite('Hash', [1000], [
+  new Benchmark('Hash', false, false, 0, Hash, Setup, TearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+const kSize = 4096;
+const kMatrixSize = 16;
+
+let doubles;
+let words;
+let a;
+let b;
+let c;
+
+function Setup() {
+  doubles = new Float64Array(kSize);
+  words = new Int32Array(kSize);
+  for (let i = 0; i < kSize; ++i) {
+    doubles[i] = i / kSize;
+    words[i] = (i * 0x9e3779b9) | 0;
+  }
+  a = new Float64Array(kMatrixSize * kMatrixSize);
+  b = new Float64Array(kMatrixSize * kMatrixSize);
+  c = new Float64Array(kMatrixSize * kMatrixSize);
+  for (let i = 0; i < a.length; ++i) {
+    a[i] = i % 7;
+    b[i] = i % 5;
+  }
+}
+
+// Two independent Horner chains per element, unrolled by two.
+function Polynomial() {
+  let sum = 0;
+  for (let i = 0; i < kSize; i += 2) {
+    const x = doubles[i];
+    const y = doubles[i + 1];
+    const p = ((((0.5 * x + 0.25) * x - 1.5) * x + 2.0) * x - 0.75) * x;
+    const q = ((((0.5 * y + 0.25) * y - 1.5) * y + 2.0) * y - 0.75) * y;
+    sum += p + q;
+  }
+  return sum;
+}
+
+// The inner loop is unrolled by four, giving each block four independent
+// load-multiply-add chains.
+function MatrixMultiply() {
+  const n = kMatrixSize;
+  for (let i = 0; i < n; ++i) {
+    for (let j = 0; j < n; ++j) {
+      let s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+      for (let k = 0; k < n; k += 4) {
+        s0 += a[i * n + k] * b[k * n + j];
+        s1 += a[i * n + k + 1] * b[(k + 1) * n + j];
+        s2 += a[i * n + k + 2] * b[(k + 2) * n + j];
+        s3 += a[i * n + k + 3] * b[(k + 3) * n + j];
+      }
+      c[i * n + j] = s0 + s1 + s2 + s3;
+    }
+  }
+  return c[n + 1];
+}
+
+// Integer multiplies and shifts on four interleaved lanes.
+function Hash() {
+  let h0 = 1, h1 = 2, h2 = 3, h3 = 4;
+  for (let i = 0; i < kSize; i += 4) {
+    h0 = Math.imul(h0 ^ words[i], 0x01000193);
+    h1 = Math.imul(h1 ^ words[i + 1], 0x01000193);
+    h2 = Math.imul(h2 ^ words[i + 2], 0x01000193);
+    h3 = Math.imul(h3 ^ words[i + 3], 0x01000193);
+    h0 ^= h0 >>> 15;
+    h1 ^= h1 >>> 15;
+    h2 ^= h2 >>> 15;
+    h3 ^= h3 >>> 15;
+  }
+  return h0 ^ h1 ^ h2 ^ h3;
+}
+
+function TearDown() {
+  doubles = undefined;
+  words = undefined;
+  a = b = c = undefined;
+}
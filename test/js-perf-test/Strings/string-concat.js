@@ -0,0 +1,67 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+const parts = [
+  'abcde', '123456', 'aqwsde', 'nbvveqxu', 'f03ks-120-3;jfkm;ajp3f',
+  'sd-93u498thikefnow8y3-0rh1nalksfnwo8y3t19-3r8hoiefnw'
+];
+
+// Appending to an accumulator builds long results, which optimized code
+// allocates as ConsStrings inline.
+
+function StringConcatAccumulate() {
+  var result = "";
+
+  for (var i = 0; i < 10; ++i) {
+    for (var j = 0; j < parts.length; ++j) {
+      result += parts[j];
+    }
+  }
+
+  return result;
+}
+createSuiteWithWarmup('StringConcatAccumulate', 1, StringConcatAccumulate);
+
+function StringConcatTemplate() {
+  var result = "";
+
+  for (var j = 0; j < parts.length; ++j) {
+    let s = parts[j];
+    result = `${result}<${s}>${s.length}</${s}>`;
+  }
+
+  return result;
+}
+createSuiteWithWarmup('StringConcatTemplate', 1, StringConcatTemplate);
+
+// Short results are still created by the StringAdd builtin.
+
+function StringConcatShort() {
+  var sum = 0;
+
+  for (var j = 0; j < parts.length; ++j) {
+    let s = parts[j].slice(0, 3);
+    sum += (s + '-' + s).length;
+  }
+
+  return sum;
+}
+createSuiteWithWarmup('StringConcatShort', 1, StringConcatShort);
+
+// Reading from the accumulated string flattens it, so this includes the
+// cost of flattening the ConsString tree built above.
+
+function StringConcatAccumulateFlatten() {
+  var result = "";
+
+  for (var i = 0; i < 10; ++i) {
+    for (var j = 0; j < parts.length; ++j) {
+      result += parts[j];
+    }
+  }
+
+  return result.charCodeAt(result.length >> 1);
+}
+createSuiteWithWarmup(
+    'StringConcatAccumulateFlatten', 1, StringConcatAccumulateFlatten);
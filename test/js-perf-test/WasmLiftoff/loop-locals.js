@@ -0,0 +1,64 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A Liftoff-compiled loop that keeps several locals live across its back
+// edge. It is run once with --liftoff-loop-locals-in-registers (the default)
+// and once without, to compare against spilling all locals at the loop header.
+
+new BenchmarkSuite('LoopLocals', [1000], [
+  new Benchmark('LoopLocals', false, false, 0, LoopLocals, LoopLocals_Setup,
+                LoopLocals_TearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+// (func (export "main") (param $n i32) (result i32)
+//   (local $i i32) (local $a i32) (local $b i32) (local $c i32) (local $d i32)
+//   (loop
+//     (local.set $a (i32.add (local.get $a) (local.get $i)))
+//     (local.set $b (i32.xor (local.get $b) (local.get $a)))
+//     (local.set $c (i32.add (local.get $c) (local.get $b)))
+//     (local.set $d (i32.add (i32.mul (local.get $d) (i32.const 31))
+//                            (local.get $c)))
+//     (br_if 0 (i32.lt_s (local.tee $i (i32.add (local.get $i) (i32.const 1)))
+//                        (local.get $n))))
+//   (i32.add (i32.add (i32.add (local.get $a) (local.get $b)) (local.get $c))
+//            (local.get $d)))
+const kModuleBytes = new Uint8Array([
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,  // header
+  0x01, 0x06, 0x01, 0x60, 0x01, 0x7f, 0x01, 0x7f,  // types: [i32] -> [i32]
+  0x03, 0x02, 0x01, 0x00,                          // functions
+  0x07, 0x08, 0x01, 0x04, 0x6d, 0x61, 0x69, 0x6e,  // exports: "main"
+  0x00, 0x00,
+  0x0a, 0x3f, 0x01, 0x3d,                          // code
+  0x01, 0x05, 0x7f,                                // locals: 5 x i32
+  0x03, 0x40,                                      // loop
+  0x20, 0x02, 0x20, 0x01, 0x6a, 0x21, 0x02,        // a = a + i
+  0x20, 0x03, 0x20, 0x02, 0x73, 0x21, 0x03,        // b = b ^ a
+  0x20, 0x04, 0x20, 0x03, 0x6a, 0x21, 0x04,        // c = c + b
+  0x20, 0x05, 0x41, 0x1f, 0x6c, 0x20, 0x04, 0x6a,  // d = d * 31 + c
+  0x21, 0x05,
+  0x20, 0x01, 0x41, 0x01, 0x6a, 0x22, 0x01,        // i = i + 1
+  0x20, 0x00, 0x48, 0x0d, 0x00,                    // br_if (i < n)
+  0x0b,                                            // end loop
+  0x20, 0x02, 0x20, 0x03, 0x6a, 0x20, 0x04, 0x6a,  // a + b + c + d
+  0x20, 0x05, 0x6a,
+  0x0b                                             // end
+]);
+
+const kIterations = 100000;
+let main;
+
+function LoopLocals_Setup() {
+  const module = new WebAssembly.Module(kModuleBytes);
+  main = new WebAssembly.Instance(module).exports.main;
+}
+
+function LoopLocals() {
+  return main(kIterations);
+}
+
+function LoopLocals_TearDown() {
+  main = undefined;
+}
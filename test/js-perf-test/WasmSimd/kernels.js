@@ -0,0 +1,206 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Image and codec kernels written with Wasm SIMD. The coefficients are
+// broadcast from a parameter vector with lane-splat shuffles, as compilers
+// targeting Wasm SIMD emit them.
+
+new BenchmarkSuite('Brighten', [1000], [
+  new Benchmark('Brighten', false, false, 0, Brighten, Setup, TearDown)
+]);
+
+new BenchmarkSuite('Fir', [1000], [
+  new Benchmark('Fir', false, false, 0, Fir, Setup, TearDown)
+]);
+
+new BenchmarkSuite('Sad', [1000], [
+  new Benchmark('Sad', false, false, 0, Sad, Setup, TearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+// Memory layout: the parameter vectors, followed by an 8-bit image, 16-bit
+// samples and the filtered samples. The sample buffer is padded for the
+// filter taps reading past its end.
+const kGain = 0;
+const kCoefficients = 16;
+const kImage = 1024;
+const kImageSize = 64 * 1024;
+const kSamples = kImage + kImageSize;
+const kNumSamples = 16 * 1024;
+const kFiltered = kSamples + 2 * kNumSamples + 16;
+const kNumTaps = 4;
+
+function SimdOp(op) {
+  return [kSimdPrefix, ...wasmUnsignedLeb(op)];
+}
+
+function Load(offset = 0) {
+  return [...SimdOp(kExprS128LoadMem), 0, ...wasmUnsignedLeb(offset)];
+}
+
+function Store() {
+  return [...SimdOp(kExprS128StoreMem), 0, 0];
+}
+
+// Broadcasts lane {lane} of the vector at {address}, {lane_size} bytes wide,
+// with an i8x16.shuffle.
+function SplatLane(address, lane, lane_size) {
+  const lanes = [];
+  for (let i = 0; i < 16; ++i) {
+    lanes.push(lane * lane_size + i % lane_size);
+  }
+  return [
+    ...wasmI32Const(address), ...Load(),
+    ...wasmI32Const(address), ...Load(),
+    ...SimdOp(kExprI8x16Shuffle), ...lanes
+  ];
+}
+
+// Advances the pointer in local {index} by one vector and leaves whether it
+// is still below the end in local {end} on the stack.
+function Advance(index, end) {
+  return [
+    kExprLocalGet, index, ...wasmI32Const(16), kExprI32Add,
+    kExprLocalTee, index, kExprLocalGet, end, kExprI32LtU
+  ];
+}
+
+function BuildKernels() {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(3, 3);
+  builder.exportMemoryAs('memory');
+
+  // brighten(pixels, end): adds the gain to every 8-bit channel, saturating.
+  builder.addFunction('brighten', kSig_v_ii)
+      .addLocals(kWasmS128, 1)
+      .addBody([
+        ...SplatLane(kGain, 0, 1), kExprLocalSet, 2,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 0,
+          kExprLocalGet, 0, ...Load(),
+          kExprLocalGet, 2,
+          ...SimdOp(kExprI8x16AddSatU),
+          ...Store(),
+          ...Advance(0, 1),
+          kExprBrIf, 0,
+        kExprEnd
+      ])
+      .exportFunc();
+
+  // fir(samples, filtered, end): a 4-tap filter over Q15 samples.
+  const fir = [];
+  for (let tap = 0; tap < kNumTaps; ++tap) {
+    fir.push(...SplatLane(kCoefficients, tap, 2), kExprLocalSet, 3 + tap);
+  }
+  fir.push(kExprLoop, kWasmVoid, kExprLocalGet, 1);
+  for (let tap = 0; tap < kNumTaps; ++tap) {
+    fir.push(
+        kExprLocalGet, 0, ...Load(2 * tap),
+        kExprLocalGet, 3 + tap,
+        ...SimdOp(kExprI16x8Q15MulRSatS));
+    if (tap > 0) fir.push(...SimdOp(kExprI16x8AddSatS));
+  }
+  fir.push(
+      ...Store(),
+      kExprLocalGet, 0, ...wasmI32Const(16), kExprI32Add, kExprLocalSet, 0,
+      ...Advance(1, 2),
+      kExprBrIf, 0,
+      kExprEnd);
+  builder.addFunction('fir', kSig_v_iii)
+      .addLocals(kWasmS128, kNumTaps)
+      .addBody(fir)
+      .exportFunc();
+
+  // sad(a, b, end): the sum of absolute differences of two 8-bit blocks, as
+  // used for motion estimation.
+  builder.addFunction('sad', kSig_i_iii)
+      .addLocals(kWasmS128, 1)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 0, ...Load(), kExprLocalGet, 1, ...Load(),
+          ...SimdOp(kExprI8x16SubSatU),
+          kExprLocalGet, 1, ...Load(), kExprLocalGet, 0, ...Load(),
+          ...SimdOp(kExprI8x16SubSatU),
+          ...SimdOp(kExprS128Or),
+          ...SimdOp(kExprI16x8ExtAddPairwiseI8x16U),
+          ...SimdOp(kExprI32x4ExtAddPairwiseI16x8U),
+          kExprLocalGet, 3,
+          ...SimdOp(kExprI32x4Add),
+          kExprLocalSet, 3,
+          kExprLocalGet, 1, ...wasmI32Const(16), kExprI32Add, kExprLocalSet, 1,
+          ...Advance(0, 2),
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 3, ...SimdOp(kExprI32x4ExtractLane), 0,
+        kExprLocalGet, 3, ...SimdOp(kExprI32x4ExtractLane), 1,
+        kExprI32Add,
+        kExprLocalGet, 3, ...SimdOp(kExprI32x4ExtractLane), 2,
+        kExprI32Add,
+        kExprLocalGet, 3, ...SimdOp(kExprI32x4ExtractLane), 3,
+        kExprI32Add
+      ])
+      .exportFunc();
+
+  return builder.instantiate().exports;
+}
+
+let kernels;
+let heap8;
+let heap16;
+
+function Setup() {
+  kernels = BuildKernels();
+  heap8 = new Uint8Array(kernels.memory.buffer);
+  heap16 = new Int16Array(kernels.memory.buffer);
+  heap8[kGain] = 3;
+  const coefficients = [0x1000, 0x3000, 0x3000, 0x1000];
+  for (let tap = 0; tap < kNumTaps; ++tap) {
+    heap16[kCoefficients / 2 + tap] = coefficients[tap];
+  }
+  let seed = 1;
+  for (let i = kImage; i < kFiltered; ++i) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    heap8[i] = seed >> 16;
+  }
+  // Check the kernels against scalar implementations once.
+  const pixel = heap8[kImage];
+  kernels.brighten(kImage, kImage + kImageSize);
+  if (heap8[kImage] != Math.min(255, pixel + 3)) {
+    throw new Error('brighten');
+  }
+  kernels.fir(kSamples, kFiltered, kFiltered + 2 * kNumSamples);
+  let expected = 0;
+  for (let tap = 0; tap < kNumTaps; ++tap) {
+    const product =
+        (heap16[kSamples / 2 + tap] * coefficients[tap] + 0x4000) >> 15;
+    expected = Math.max(-0x8000, Math.min(0x7fff, expected + product));
+  }
+  if (heap16[kFiltered / 2] != expected) throw new Error('fir');
+  let sad = 0;
+  for (let i = 0; i < kImageSize / 2; ++i) {
+    sad += Math.abs(heap8[kImage + i] - heap8[kSamples + i]);
+  }
+  if (kernels.sad(kImage, kSamples, kImage + kImageSize / 2) != sad) {
+    throw new Error('sad');
+  }
+}
+
+function Brighten() {
+  kernels.brighten(kImage, kImage + kImageSize);
+}
+
+function Fir() {
+  kernels.fir(kSamples, kFiltered, kFiltered + 2 * kNumSamples);
+}
+
+function Sad() {
+  return kernels.sad(kImage, kSamples, kImage + kImageSize / 2);
+}
+
+function TearDown() {
+  kernels = undefined;
+  heap8 = undefined;
+  heap16 = undefined;
+}
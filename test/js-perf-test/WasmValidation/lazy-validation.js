@@ -0,0 +1,29 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Compiles the module synchronously with --wasm-lazy-compilation, so that all
+// function bodies are validated by the parallel validation job instead of
+// during compilation. Compare against --wasm-num-compilation-tasks=0 for
+// single-threaded validation.
+
+new BenchmarkSuite('LazyValidation', [1000], [
+  new Benchmark('LazyValidation', false, false, 0, LazyValidation,
+                LazyValidation_Setup, LazyValidation_TearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+let moduleBytes;
+
+function LazyValidation_Setup() {
+  moduleBytes = BuildModule();
+}
+
+function LazyValidation() {
+  return new WebAssembly.Module(moduleBytes);
+}
+
+function LazyValidation_TearDown() {
+  moduleBytes = undefined;
+}
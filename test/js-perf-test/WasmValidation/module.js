@@ -0,0 +1,28 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A module of many small functions, so that validation of the function bodies
+// dominates compile time with --wasm-lazy-compilation.
+
+const kNumFunctions = 2000;
+
+function BuildModule() {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  // (func (param $p i32) (param $acc i32) (result i32)
+  //   20 x (local.set $acc
+  //          (i32.load (i32.add (local.get $p) (local.get $acc))))
+  //   (local.get $acc))
+  const body = [];
+  for (let i = 0; i < 20; ++i) {
+    body.push(
+        kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add,
+        kExprI32LoadMem, 2, 0, kExprLocalSet, 1);
+  }
+  body.push(kExprLocalGet, 1);
+  for (let i = 0; i < kNumFunctions; ++i) {
+    builder.addFunction('f' + i, kSig_i_ii).addBody(body);
+  }
+  return builder.toBuffer();
+}
@@ -0,0 +1,48 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Compiles the module with WebAssembly.compileStreaming, which needs
+// --wasm-test-streaming in d8. With --wasm-lazy-compilation, function bodies
+// are validated by the streaming validation job while the module is still
+// being received. Compare against --wasm-num-compilation-tasks=0, which
+// validates them on the streaming thread.
+//
+// Streaming compilation only finishes asynchronously, which the synchronous
+// BenchmarkSuite runner cannot wait for, so the measurement loop is driven
+// here. The score is computed like BenchmarkSuite does it.
+
+d8.file.execute('../base.js');
+d8.file.execute('../../mjsunit/wasm/wasm-module-builder.js');
+d8.file.execute('module.js');
+
+const kReference = 1000;
+
+function PrintResult(name, result) {
+  print(name + '-WasmValidation(Score): ' + result);
+}
+
+async function Measure(bytes) {
+  let runs = 0;
+  const start = performance.now();
+  let elapsed = 0;
+  while (elapsed < 1000) {
+    await WebAssembly.compileStreaming(Promise.resolve(bytes));
+    ++runs;
+    elapsed = performance.now() - start;
+  }
+  return elapsed * 1000 / runs;
+}
+
+async function StreamingValidation() {
+  const bytes = BuildModule();
+  await Measure(bytes);  // Warm up.
+  const usec = await Measure(bytes);
+  PrintResult('StreamingValidation',
+              BenchmarkSuite.FormatScore(100 * kReference / usec));
+}
+
+StreamingValidation().catch(error => {
+  PrintResult('StreamingValidation', error);
+  quit(1);
+});
@@ -0,0 +1,72 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Allocation-heavy workloads for comparing the young generation collectors.
+// They are run once with the Scavenger and once with --minor-mc; run with
+// --trace-gc-nvp to compare pause times and memory.
+
+new BenchmarkSuite('ShortLived', [1000], [
+  new Benchmark('ShortLived', false, false, 0, ShortLived)
+]);
+
+new BenchmarkSuite('MediumLived', [1000], [
+  new Benchmark('MediumLived', false, false, 0, MediumLived,
+                MediumLived_Setup, MediumLived_TearDown)
+]);
+
+new BenchmarkSuite('Promoted', [1000], [
+  new Benchmark('Promoted', false, false, 0, Promoted, Promoted_Setup,
+                Promoted_TearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+// Almost everything dies young.
+function ShortLived() {
+  let sum = 0;
+  for (let i = 0; i < 100000; i++) {
+    const o = {a: i, b: [i, i + 1], c: 'x' + i};
+    sum += o.b.length;
+  }
+  return sum;
+}
+
+// A ring buffer keeps objects alive for a few young generation cycles.
+const kRingSize = 50000;
+let ring;
+
+function MediumLived_Setup() {
+  ring = new Array(kRingSize);
+}
+
+function MediumLived() {
+  for (let i = 0; i < 100000; i++) {
+    ring[i % kRingSize] = {value: i, next: [i]};
+  }
+}
+
+function MediumLived_TearDown() {
+  ring = undefined;
+  return true;
+}
+
+// Most objects survive and are promoted, interleaved with garbage.
+let retained;
+
+function Promoted_Setup() {
+  retained = [];
+}
+
+function Promoted() {
+  for (let i = 0; i < 20000; i++) {
+    const garbage = new Array(8).fill(i);
+    if (i % 2 == 0) retained.push({id: i, data: garbage});
+  }
+  if (retained.length > 200000) retained = [];
+}
+
+function Promoted_TearDown() {
+  retained = undefined;
+  return true;
+}
@@ -0,0 +1,32 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --opt --no-always-opt --no-stress-opt
+// Flags: --no-concurrent-recompilation --turbo-compile-budget
+// Flags: --turbo-budget-max-nodes=1 --trace-turbo-budget
+// Flags: --turbo-loop-peeling --turbo-loop-invariant-code-motion
+// Flags: --turbo-load-elimination --turbo-escape
+// Flags: --no-turbo-instruction-scheduling
+
+d8.file.execute("test/mjsunit/mjsunit.js");
+
+// With a tiny budget, all optional phases are skipped, which is traced. The
+// generated code must still be correct.
+
+function foo(a, n) {
+  let sum = 0;
+  for (let i = 0; i < n; ++i) {
+    const o = {x: a[i], y: i};
+    sum += o.x + o.y;
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(foo);
+assertEquals(9, foo([1, 2, 3], 3));
+assertEquals(9, foo([1, 2, 3], 3));
+%OptimizeFunctionOnNextCall(foo);
+assertEquals(9, foo([1, 2, 3], 3));
+assertEquals(22, foo([1, 2, 3, 4, 6], 5));
+assertOptimized(foo);
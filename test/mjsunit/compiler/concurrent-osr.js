@@ -0,0 +1,84 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --use-osr --concurrent-osr
+// Flags: --concurrent-recompilation
+
+const kCanTestConcurrentOsr = %IsConcurrentRecompilationSupported() &&
+    !isNeverOptimize() && !isAlwaysOptimize();
+
+let status_queued;
+let status_triggered_again;
+let status_finalized;
+
+function f(n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum += i;
+    // The status can't be checked with a helper function here, because
+    // calling it would deoptimize the OSR code for lack of call feedback.
+    if (i == 5) {
+      // Queue the OSR job on the next back edge; the loop keeps running in
+      // unoptimized code.
+      %OptimizeOsr();
+    } else if (i == 6) {
+      status_queued = %GetOptimizationStatus(f);
+      // Trigger OSR again while the job is pending; this must not queue a
+      // second job for the same loop.
+      %OptimizeOsr();
+    } else if (i == 7) {
+      status_triggered_again = %GetOptimizationStatus(f);
+      // Install the finished job; the next back edge enters the OSR code.
+      %FinalizeOptimization();
+    } else if (i == 8) {
+      status_finalized = %GetOptimizationStatus(f);
+    }
+  }
+  return sum;
+}
+%PrepareFunctionForOptimization(f);
+// Keep finished jobs in the output queue until %FinalizeOptimization.
+if (kCanTestConcurrentOsr) %DisableOptimizationFinalization();
+assertEquals(4950, f(100));
+if (kCanTestConcurrentOsr) {
+  assertTrue((status_queued &
+              V8OptimizationStatus.kOptimizingConcurrently) !== 0);
+  assertTrue((status_queued &
+              V8OptimizationStatus.kTopmostFrameIsTurboFanned) === 0);
+  assertTrue((status_triggered_again &
+              V8OptimizationStatus.kOptimizingConcurrently) !== 0);
+  assertTrue((status_triggered_again &
+              V8OptimizationStatus.kTopmostFrameIsTurboFanned) === 0);
+  assertTrue((status_finalized &
+              V8OptimizationStatus.kOptimizingConcurrently) === 0);
+  assertTrue((status_finalized &
+              V8OptimizationStatus.kTopmostFrameIsTurboFanned) !== 0);
+}
+assertEquals(4950, f(100));
+
+let inner_status_finalized;
+
+function g(n) {
+  let result = 0;
+  for (let i = 0; i < n; i++) {
+    for (let j = 0; j < n; j++) {
+      result += i * j;
+      if (i == 1 && j == 1) %OptimizeOsr();
+      // Finalizing re-arms the inner loop, whose next back edge enters the OSR
+      // code.
+      if (i == 1 && j == 3) %FinalizeOptimization();
+      if (i == 1 && j == 5) inner_status_finalized = %GetOptimizationStatus(g);
+    }
+  }
+  return result;
+}
+%PrepareFunctionForOptimization(g);
+if (kCanTestConcurrentOsr) %DisableOptimizationFinalization();
+assertEquals(36100, g(20));
+if (kCanTestConcurrentOsr) {
+  assertTrue((inner_status_finalized &
+              V8OptimizationStatus.kOptimizingConcurrently) === 0);
+  assertTrue((inner_status_finalized &
+              V8OptimizationStatus.kTopmostFrameIsTurboFanned) !== 0);
+}
@@ -0,0 +1,111 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --turbo-context-pretenuring --allocation-site-pretenuring
+// Flags: --expose-gc --stress-scavenge=0
+
+// Literals of inlined callees carry allocation mementos for the caller's own
+// allocation sites. The objects must still be intact, and pretenuring is
+// decided per caller.
+
+function makeNode(value) {
+  return {value: value, next: null};
+}
+function makeArray(value) {
+  return [value, value + 1];
+}
+%PrepareFunctionForOptimization(makeNode);
+%PrepareFunctionForOptimization(makeArray);
+
+(function TestLongLived() {
+  function build(n) {
+    let head = null;
+    for (let i = 0; i < n; ++i) {
+      const node = makeNode(i);
+      node.next = head;
+      head = node;
+    }
+    return head;
+  }
+
+  %PrepareFunctionForOptimization(build);
+  build(10);
+  build(10);
+  %OptimizeFunctionOnNextCall(build);
+  const list = build(10000);
+  gc();
+  let count = 0;
+  for (let node = list; node !== null; node = node.next) {
+    assertEquals(9999 - count, node.value);
+    ++count;
+  }
+  assertEquals(10000, count);
+})();
+
+(function TestShortLived() {
+  function sum(n) {
+    let s = 0;
+    for (let i = 0; i < n; ++i) {
+      const a = makeArray(i);
+      s += a[0] + a[1] + makeNode(i).value;
+    }
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(12, sum(3));
+  assertEquals(12, sum(3));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(12, sum(3));
+  assertEquals(3 * 4950 + 100, sum(100));
+  gc();
+  assertEquals(3 * 4950 + 100, sum(100));
+})();
+
+(function TestPretenuringIsPerCaller() {
+  function build(n) {
+    let head = null;
+    for (let i = 0; i < n; ++i) {
+      const node = makeNode(i);
+      node.next = head;
+      head = node;
+    }
+    return head;
+  }
+  function consume(i) {
+    return makeNode(i);
+  }
+
+  %PrepareFunctionForOptimization(build);
+  %PrepareFunctionForOptimization(consume);
+  build(2);
+  consume(1);
+  %OptimizeFunctionOnNextCall(build);
+  build(2);
+  %OptimizeFunctionOnNextCall(consume);
+  consume(1);
+  if (isNeverOptimize()) return;
+  assertOptimized(build);
+  assertOptimized(consume);
+
+  // The node built by the optimized {build} carries a memento for the site
+  // that {build} has for the literal in {makeNode}. Tenuring that site only
+  // deoptimizes {build}.
+  const node = build(1);
+  assertTrue(%InYoungGeneration(node));
+  assertTrue(%PretenureAllocationSite(node));
+  gc();
+  assertUnoptimized(build);
+  assertOptimized(consume);
+
+  %PrepareFunctionForOptimization(build);
+  build(2);
+  %OptimizeFunctionOnNextCall(build);
+  build(2);
+  assertOptimized(build);
+  assertFalse(%InYoungGeneration(build(1)));
+  assertTrue(%InYoungGeneration(consume(1)));
+  assertTrue(%InYoungGeneration(makeNode(1)));
+})();
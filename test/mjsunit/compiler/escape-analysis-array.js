@@ -32,3 +32,41 @@
   assertEquals("first", f(0));
   assertEquals("second", f(1));
 })();
+
+// Test arrays with a small length that is not a constant but bounded.
+(function testBoundedLengthArray() {
+  function f(n) {
+    const a = new Array(n & 3);
+    return a.length;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(0, f(0));
+  assertEquals(3, f(3));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(0, f(0));
+  assertEquals(1, f(5));
+  assertEquals(3, f(7));
+  assertOptimized(f);
+})();
+
+// Test deoptimization with a bounded length array, which has to be
+// materialized with the right length and no elements.
+(function testBoundedLengthArrayDeopt() {
+  function f(n, deopt) {
+    const a = new Array(n & 7);
+    if (deopt) {
+      %_DeoptimizeNow();
+      assertFalse(0 in a);
+      assertEquals(undefined, a[0]);
+    }
+    return a.length;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(2, f(2, false));
+  assertEquals(6, f(6, false));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(5, f(5, false));
+  assertEquals(4, f(4, true));
+})();
@@ -0,0 +1,101 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape
+
+// Reducer-style helpers that update an accumulator in place and return it
+// make the accumulator flow through a loop phi.
+function add(acc, x, y) {
+  acc.x += x;
+  acc.y += y;
+  return acc;
+}
+
+(function testDestructuringLoop() {
+  function sum(points) {
+    let acc = {x: 0, y: 0};
+    for (const {x, y} of points) acc = add(acc, x, y);
+    return acc;
+  }
+
+  const points = [{x: 1, y: 2}, {x: 3, y: 4}, {x: 5, y: 6}];
+  const empty = sum([]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals({x: 9, y: 12}, sum(points));
+  assertEquals({x: 9, y: 12}, sum(points));
+  %OptimizeFunctionOnNextCall(sum);
+  const result = sum(points);
+  assertOptimized(sum);
+  assertEquals({x: 9, y: 12}, result);
+  // The escaping result has the map of one from unoptimized code.
+  assertTrue(%HaveSameMap(empty, result));
+})();
+
+// Deoptimizing inside of the loop materializes the accumulator with the field
+// values of the current iteration.
+(function testDeoptInsideLoop() {
+  function sum(points, deopt_at) {
+    let acc = {x: 0, y: 0};
+    for (let i = 0; i < points.length; i++) {
+      const {x, y} = points[i];
+      acc = add(acc, x, y);
+      if (i == deopt_at) {
+        %_DeoptimizeNow();
+        assertEquals({x: 2 * (i + 1), y: i + 1}, acc);
+      }
+    }
+    return acc.x + acc.y;
+  }
+
+  const points = [];
+  for (let i = 0; i < 6; i++) points.push({x: 2, y: 1});
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(18, sum(points, -1));
+  assertEquals(18, sum(points, -1));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(18, sum(points, -1));
+  assertEquals(18, sum(points, 2));
+})();
+
+// An iterator that is advanced through a helper returning it is threaded
+// through the loop phi as well.
+(function testIteratorThroughLoopPhi() {
+  function advance(it) {
+    it.next();
+    return it;
+  }
+  function count(array) {
+    let it = array[Symbol.iterator]();
+    let n = 0;
+    for (let i = 0; i < array.length; i++) {
+      it = advance(it);
+      n++;
+    }
+    return n + (it.next().done ? 0 : 100);
+  }
+
+  %PrepareFunctionForOptimization(count);
+  assertEquals(3, count([1, 2, 3]));
+  assertEquals(3, count([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(count);
+  assertEquals(4, count([1, 2, 3, 4]));
+  assertEquals(0, count([]));
+})();
+
+// Different objects merged at a loop phi still have to escape.
+(function testDifferentObjectsAtLoopPhi() {
+  function sum(points) {
+    let acc = {x: 0, y: 0};
+    for (const {x, y} of points) acc = {x: acc.x + x, y: acc.y + y};
+    return acc;
+  }
+
+  const points = [{x: 1, y: 2}, {x: 3, y: 4}];
+  %PrepareFunctionForOptimization(sum);
+  assertEquals({x: 4, y: 6}, sum(points));
+  assertEquals({x: 4, y: 6}, sum(points));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals({x: 4, y: 6}, sum(points));
+  assertEquals({x: 0, y: 0}, sum([]));
+})();
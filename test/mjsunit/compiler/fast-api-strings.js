@@ -0,0 +1,97 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// This file excercises one-byte string support for fast API calls.
+
+// Flags: --turbo-fast-api-calls --expose-fast-api --allow-natives-syntax --opt
+// --always-opt is disabled because we rely on particular feedback for
+// optimizing to the fastest path.
+// Flags: --no-always-opt
+// The test relies on optimizing/deoptimizing at predictable moments, so
+// it's not suitable for deoptimization fuzzing.
+// Flags: --deopt-every-n-times=0
+
+d8.file.execute('test/mjsunit/compiler/fast-api-helpers.js');
+
+const fast_c_api = new d8.test.FastCAPI();
+
+// ----------- sum_one_byte_string -----------
+// `sum_one_byte_string` has the following signature:
+// uint32_t sum_one_byte_string(bool /*should_fallback*/, FastOneByteString)
+
+// Sequential one-byte string - regular call hits the fast path.
+(function () {
+  function one_byte_test() {
+    return fast_c_api.sum_one_byte_string(false /* should_fallback */, 'abc');
+  }
+  ExpectFastCall(one_byte_test, 294);
+})();
+
+// Latin-1 characters above 0x7F are still one-byte.
+(function () {
+  function latin1_test() {
+    return fast_c_api.sum_one_byte_string(false /* should_fallback */,
+      '\xff\xe9');
+  }
+  ExpectFastCall(latin1_test, 0xff + 0xe9);
+})();
+
+// Empty string.
+(function () {
+  function empty_test() {
+    return fast_c_api.sum_one_byte_string(false /* should_fallback */, '');
+  }
+  ExpectFastCall(empty_test, 0);
+})();
+
+// Two-byte strings take the slow path.
+(function () {
+  function two_byte_test() {
+    return fast_c_api.sum_one_byte_string(false /* should_fallback */,
+      'aሴ');
+  }
+  ExpectSlowCall(two_byte_test, 0x61 + 0x1234);
+})();
+
+// Cons strings take the slow path.
+(function () {
+  function cons_string_test(str) {
+    return fast_c_api.sum_one_byte_string(false /* should_fallback */, str);
+  }
+  const input = %ConstructConsString('abcdefghijklm', 'nopqrstuvwxyz');
+
+  %PrepareFunctionForOptimization(cons_string_test);
+  cons_string_test('a');
+  %OptimizeFunctionOnNextCall(cons_string_test);
+  assertEquals(97, cons_string_test('a'));
+  assertOptimized(cons_string_test);
+
+  fast_c_api.reset_counts();
+  assertEquals(2847, cons_string_test(input));
+  assertEquals(0, fast_c_api.fast_call_count());
+  assertEquals(1, fast_c_api.slow_call_count());
+})();
+
+// Explicit fallback from the fast callback.
+(function () {
+  function fallback_test() {
+    return fast_c_api.sum_one_byte_string(true /* should_fallback */, 'abc');
+  }
+  optimize_and_check(fallback_test, 1, 1, 294);
+})();
+
+// Passing non-string arguments falls down the slow path.
+(function () {
+  function sum_one_byte_string_mismatch(arg) {
+    return fast_c_api.sum_one_byte_string(false /* should_fallback */, arg);
+  }
+
+  %PrepareFunctionForOptimization(sum_one_byte_string_mismatch);
+  sum_one_byte_string_mismatch('a');
+  %OptimizeFunctionOnNextCall(sum_one_byte_string_mismatch);
+
+  assert_throws_and_optimized(sum_one_byte_string_mismatch, 42);
+  assert_throws_and_optimized(sum_one_byte_string_mismatch, {});
+  assert_throws_and_optimized(sum_one_byte_string_mismatch, Symbol());
+})();
@@ -0,0 +1,84 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-invariant-code-motion
+
+(function TestInvariantFieldLoad() {
+  function sum(o, n) {
+    let s = 0;
+    for (let i = 0; i < n; i++) s += o.x;
+    return s;
+  }
+  const o = {x: 3};
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(30, sum(o, 10));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(30, sum(o, 10));
+  assertEquals(0, sum(o, 0));
+  assertOptimized(sum);
+})();
+
+(function TestFieldWrittenInLoop() {
+  function count(o, n) {
+    let s = 0;
+    for (let i = 0; i < n; i++) {
+      s += o.x;
+      o.x = i;
+    }
+    return s;
+  }
+  %PrepareFunctionForOptimization(count);
+  assertEquals(1 + 0 + 1 + 2, count({x: 1}, 4));
+  %OptimizeFunctionOnNextCall(count);
+  assertEquals(1 + 0 + 1 + 2, count({x: 1}, 4));
+})();
+
+(function TestOtherFieldWrittenInLoop() {
+  function f(o, n) {
+    let s = 0;
+    for (let i = 0; i < n; i++) {
+      s += o.x;
+      o.y = s;
+    }
+    return s;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(10, f({x: 2, y: 0}, 5));
+  %OptimizeFunctionOnNextCall(f);
+  const o = {x: 2, y: 0};
+  assertEquals(10, f(o, 5));
+  assertEquals(10, o.y);
+})();
+
+(function TestNestedLoops() {
+  function f(a, n) {
+    let s = 0;
+    for (let i = 0; i < n; i++) {
+      for (let j = 0; j < a.length; j++) s += a[j];
+    }
+    return s;
+  }
+  const a = [1, 2, 3];
+  %PrepareFunctionForOptimization(f);
+  assertEquals(18, f(a, 3));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(18, f(a, 3));
+})();
+
+(function TestLoopWithCall() {
+  function g(o) { o.x++; }
+  %NeverOptimizeFunction(g);
+  function f(o, n) {
+    let s = 0;
+    for (let i = 0; i < n; i++) {
+      s += o.x;
+      g(o);
+    }
+    return s;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(0 + 1 + 2, f({x: 0}, 3));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(0 + 1 + 2, f({x: 0}, 3));
+})();
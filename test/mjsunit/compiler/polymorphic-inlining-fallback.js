@@ -0,0 +1,170 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --opt --inline-dominant-targets
+
+function f0(x) { return x + 0; }
+function f1(x) { return x + 1; }
+function f2(x) { return x + 2; }
+function f3(x) { return x + 3; }
+function f4(x) { return x + 4; }
+function thrower(x) { throw x; }
+[f0, f1, f2, f3, f4, thrower].forEach(f => %PrepareFunctionForOptimization(f));
+
+(function TooManyKnownTargets() {
+  function foo(i, x) {
+    let f;
+    switch (i) {
+      case 0: f = f0; break;
+      case 1: f = f1; break;
+      case 2: f = f2; break;
+      case 3: f = f3; break;
+      default: f = f4; break;
+    }
+    return f(x);
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  for (let i = 0; i < 5; ++i) assertEquals(10 + i, foo(i, 10));
+  // Make {f4} the least frequently invoked target.
+  for (let i = 0; i < 4; ++i) assertEquals(10 + i, foo(i, 10));
+  %OptimizeFunctionOnNextCall(foo);
+  for (let i = 0; i < 5; ++i) assertEquals(10 + i, foo(i, 10));
+  assertOptimized(foo);
+})();
+
+(function UnknownTarget() {
+  function foo(g, x) {
+    const f = g === undefined ? f1 : g;
+    return f(x);
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(2, foo(undefined, 1));
+  assertEquals(3, foo(f2, 1));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(2, foo(undefined, 1));
+  assertEquals(3, foo(f2, 1));
+  assertEquals(5, foo(f4, 1));
+  assertEquals(6, foo(x => x + 5, 1));
+  assertOptimized(foo);
+})();
+
+(function ExceptionFromFallback() {
+  function foo(g, x) {
+    const f = g === undefined ? f1 : g;
+    try {
+      return f(x);
+    } catch (e) {
+      return -e;
+    }
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(2, foo(undefined, 1));
+  assertEquals(-1, foo(thrower, 1));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(2, foo(undefined, 1));
+  assertEquals(-1, foo(thrower, 1));
+  assertEquals(-7, foo(x => { throw x * 7; }, 1));
+})();
+
+(function ConstructWithFallback() {
+  function A(x) { this.x = x; }
+  function B(x) { this.x = x + 1; }
+  %PrepareFunctionForOptimization(A);
+  %PrepareFunctionForOptimization(B);
+
+  function foo(C, x) {
+    const K = C === undefined ? A : C;
+    return new K(x);
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(1, foo(undefined, 1).x);
+  assertEquals(2, foo(B, 1).x);
+  %OptimizeFunctionOnNextCall(foo);
+  assertInstanceof(foo(undefined, 1), A);
+  assertInstanceof(foo(B, 1), B);
+  class D { constructor(x) { this.x = x * 2; } }
+  const d = foo(D, 3);
+  assertInstanceof(d, D);
+  assertEquals(6, d.x);
+})();
+
+(function InlinesMostFrequentTargets() {
+  // A target that is inlined into the optimized {foo} has no frame of its
+  // own, so it does not see itself executing.
+  const executing = {};
+  function record(f) {
+    executing[f.name] =
+        (%GetOptimizationStatus(f) & V8OptimizationStatus.kIsExecuting) !== 0;
+  }
+  function a(x) { record(a); return x + 1; }
+  function b(x) { record(b); return x + 2; }
+  function c(x) { record(c); return x + 3; }
+  function d(x) { record(d); return x + 4; }
+  function rare(x) { record(rare); return x + 5; }
+  [a, b, c, d, rare].forEach(f => %PrepareFunctionForOptimization(f));
+
+  function foo(i, x) {
+    let f;
+    switch (i) {
+      case 0: f = a; break;
+      case 1: f = b; break;
+      case 2: f = c; break;
+      case 3: f = d; break;
+      default: f = rare; break;
+    }
+    return f(x);
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  for (let n = 0; n < 10; ++n) {
+    for (let i = 0; i < 4; ++i) assertEquals(11 + i, foo(i, 10));
+  }
+  assertEquals(15, foo(4, 10));
+  %OptimizeFunctionOnNextCall(foo);
+  for (let i = 0; i < 5; ++i) assertEquals(11 + i, foo(i, 10));
+  if (isNeverOptimize()) return;
+  assertOptimized(foo);
+  // The kMaxCallPolymorphism most frequently invoked targets are inlined,
+  // the rarely invoked one is reached through the generic call.
+  assertFalse(executing.a);
+  assertFalse(executing.b);
+  assertFalse(executing.c);
+  assertFalse(executing.d);
+  assertTrue(executing.rare);
+})();
+
+(function NonInlineableDominantTarget() {
+  function rare(x) { return x + 1; }
+  // The most frequently invoked target takes the first dispatch slot, which
+  // the scan of the phi inputs had filled with {rare} before it reached the
+  // unknown input.
+  function hot(x) { return x + 2; }
+  %PrepareFunctionForOptimization(rare);
+  %NeverOptimizeFunction(hot);
+
+  function foo(i, g, x) {
+    let f;
+    switch (i) {
+      case 0: f = rare; break;
+      case 1: f = hot; break;
+      default: f = g; break;
+    }
+    return f(x);
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(11, foo(0, undefined, 10));
+  for (let n = 0; n < 10; ++n) assertEquals(12, foo(1, undefined, 10));
+  assertEquals(13, foo(2, x => x + 3, 10));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(11, foo(0, undefined, 10));
+  assertEquals(12, foo(1, undefined, 10));
+  assertEquals(13, foo(2, x => x + 3, 10));
+  if (isNeverOptimize()) return;
+  assertOptimized(foo);
+})();
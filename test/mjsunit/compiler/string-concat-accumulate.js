@@ -0,0 +1,50 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --opt
+
+(function TestAccumulateInLoop() {
+  function render(parts) {
+    let s = '';
+    for (let i = 0; i < parts.length; ++i) {
+      s += parts[i];
+    }
+    return s;
+  }
+
+  const parts = ['<div>', '', 'hello', '</div>', '☃', 'x'.repeat(20)];
+  const expected = parts.join('');
+  %PrepareFunctionForOptimization(render);
+  assertEquals(expected, render(parts));
+  assertEquals(expected, render(parts));
+  %OptimizeFunctionOnNextCall(render);
+  assertEquals(expected, render(parts));
+  assertEquals('', render([]));
+  assertEquals('ab', render(['a', 'b']));
+  assertEquals(expected + expected, render(parts.concat(parts)));
+  assertOptimized(render);
+})();
+
+(function TestConcatEdgeCases() {
+  function concat(a, b) { return a + b; }
+
+  %PrepareFunctionForOptimization(concat);
+  assertEquals('ab', concat('a', 'b'));
+  assertEquals('ab', concat('a', 'b'));
+  %OptimizeFunctionOnNextCall(concat);
+  assertEquals('ab', concat('a', 'b'));
+
+  const long = 'abcdefghijklmnopqrstuvwxyz';
+  assertEquals(long, concat(long, ''));
+  assertEquals(long, concat('', long));
+  assertEquals(long + long, concat(long, long));
+  assertEquals('abc☃' + long, concat('abc☃', long));
+  assertEquals(long + '☃', concat(long, '☃'));
+
+  const s = concat(long, long);
+  assertEquals(52, s.length);
+  assertEquals('z', s[51]);
+  assertEquals(long.charCodeAt(3), s.charCodeAt(29));
+  assertOptimized(concat);
+})();
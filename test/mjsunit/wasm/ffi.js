@@ -415,3 +415,29 @@ testCallBinopVoid(kWasmF64);
 
   builder.instantiate(ffi);
 })();
+
+(function ImportReturnsFloat64Values() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addImport("", "func", kSig_d_v);
+  builder.addFunction("main", kSig_d_v)
+      .addBody([kExprCallFunction, 0])
+      .exportFunc();
+  builder.addFunction("identity", kSig_d_d)
+      .addBody([kExprLocalGet, 0])
+      .exportFunc();
+  let value;
+  const instance = builder.instantiate({"": {func: () => value}});
+  const values = [
+    [0, 0], [-7, -7], [2 ** 31, 2 ** 31], [1.5, 1.5], [-0, -0],
+    [NaN, NaN], ["2.5", 2.5], [true, 1], [undefined, NaN], [null, 0],
+    [{valueOf: () => 3.25}, 3.25]
+  ];
+  for (const [input, expected] of values) {
+    // Wasm-to-JS: conversion of the return value.
+    value = input;
+    assertEquals(expected, instance.exports.main());
+    // JS-to-Wasm: conversion of the parameter.
+    assertEquals(expected, instance.exports.identity(input));
+  }
+})();
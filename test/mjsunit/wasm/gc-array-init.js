@@ -0,0 +1,136 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-gc --no-liftoff
+
+// Tests array.init in TurboFan. Short arrays are allocated inline, arrays with
+// more than 64 elements are allocated by a builtin call.
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+const kMaxInlineLength = 64;
+
+function arrayInit(array, elements) {
+  return [...elements.flat(), kGCPrefix, kExprArrayInitStatic, array,
+          ...wasmUnsignedLeb(elements.length)];
+}
+
+(function ArrayInitLengths() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let array = builder.addArray(kWasmI32, true);
+  let lengths = [0, 1, kMaxInlineLength, kMaxInlineLength + 1, 999];
+  for (let length of lengths) {
+    let elements = [];
+    for (let i = 0; i < length; i++) elements.push(wasmI32Const(i * 3 + 1));
+    builder.addFunction("len" + length, kSig_i_v)
+      .addBody([...arrayInit(array, elements), kGCPrefix, kExprArrayLen, array])
+      .exportFunc();
+    if (length == 0) continue;
+    builder.addFunction("get" + length, kSig_i_i)
+      .addBody([...arrayInit(array, elements),
+                kExprLocalGet, 0,
+                kGCPrefix, kExprArrayGet, array])
+      .exportFunc();
+  }
+  let instance = builder.instantiate();
+  for (let length of lengths) {
+    assertEquals(length, instance.exports["len" + length]());
+    if (length == 0) continue;
+    let get = instance.exports["get" + length];
+    for (let i of [0, length >> 1, length - 1]) {
+      assertEquals(i * 3 + 1, get(i));
+    }
+    assertThrows(() => get(length), WebAssembly.RuntimeError,
+                 /array element access out of bounds/);
+  }
+})();
+
+(function ArrayInitElementTypes() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let struct = builder.addStruct([makeField(kWasmI32, false)]);
+  let i8_array = builder.addArray(kWasmI8, true);
+  let i16_array = builder.addArray(kWasmI16, false);
+  let i32_array = builder.addArray(kWasmI32, false);
+  let i64_array = builder.addArray(kWasmI64, true);
+  let f32_array = builder.addArray(kWasmF32, true);
+  let f64_array = builder.addArray(kWasmF64, false);
+  let s128_array = builder.addArray(kWasmS128, true);
+  let extern_array = builder.addArray(kWasmExternRef, true);
+  let struct_array = builder.addArray(wasmOptRefType(struct), false);
+
+  // For each length, test both the inline and the out-of-line allocation.
+  for (let length of [3, kMaxInlineLength + 1]) {
+    let fill = (first, last) => {
+      let elements = [first];
+      while (elements.length < length - 1) elements.push(first);
+      elements.push(last);
+      return elements;
+    };
+    let getter = (name, array, sig, elements, get = kExprArrayGet,
+                  after = []) => {
+      builder.addFunction(name + length, sig)
+        .addBody([...arrayInit(array, elements),
+                  kExprLocalGet, 0,
+                  kGCPrefix, get, array,
+                  ...after])
+        .exportFunc();
+    };
+    let i8 = fill(wasmI32Const(0x17f), wasmI32Const(0x80));
+    getter("i8_s", i8_array, kSig_i_i, i8, kExprArrayGetS);
+    getter("i8_u", i8_array, kSig_i_i, i8, kExprArrayGetU);
+    let i16 = fill(wasmI32Const(0x1ffff), wasmI32Const(0x8000));
+    getter("i16_s", i16_array, kSig_i_i, i16, kExprArrayGetS);
+    getter("i16_u", i16_array, kSig_i_i, i16, kExprArrayGetU);
+    getter("i32", i32_array, kSig_i_i,
+           fill(wasmI32Const(-1), wasmI32Const(0x7fffffff)));
+    getter("i64", i64_array, makeSig([kWasmI32], [kWasmI64]),
+           fill(wasmI64Const(-5), wasmI64Const(1 << 30)));
+    getter("f32", f32_array, makeSig([kWasmI32], [kWasmF32]),
+           fill(wasmF32Const(1.5), wasmF32Const(-0)));
+    getter("f64", f64_array, makeSig([kWasmI32], [kWasmF64]),
+           fill(wasmF64Const(Math.PI), wasmF64Const(-Infinity)));
+    getter("s128", s128_array, kSig_i_i,
+           fill([...wasmI32Const(7), kSimdPrefix, kExprI32x4Splat],
+                [...wasmI32Const(-7), kSimdPrefix, kExprI32x4Splat]),
+           kExprArrayGet, [kSimdPrefix, kExprI32x4ExtractLane, 3]);
+    builder.addFunction("extern" + length,
+                        makeSig([kWasmI32, kWasmExternRef], [kWasmExternRef]))
+      .addBody([...arrayInit(extern_array,
+                             fill([kExprRefNull, kExternRefCode],
+                                  [kExprLocalGet, 1])),
+                kExprLocalGet, 0,
+                kGCPrefix, kExprArrayGet, extern_array])
+      .exportFunc();
+    let new_struct = value => [...wasmI32Const(value),
+                                kGCPrefix, kExprStructNew, struct];
+    getter("struct", struct_array, kSig_i_i,
+           fill(new_struct(11), new_struct(22)), kExprArrayGet,
+           [kGCPrefix, kExprStructGet, struct, 0]);
+  }
+
+  let instance = builder.instantiate();
+  for (let length of [3, kMaxInlineLength + 1]) {
+    let check = (name, first, last) => {
+      let get = instance.exports[name + length];
+      assertEquals(first, get(0));
+      assertEquals(first, get(length - 2));
+      assertEquals(last, get(length - 1));
+    };
+    check("i8_s", 127, -128);
+    check("i8_u", 127, 128);
+    check("i16_s", -1, -32768);
+    check("i16_u", 0xffff, 0x8000);
+    check("i32", -1, 0x7fffffff);
+    check("i64", -5n, 1n << 30n);
+    check("f32", 1.5, -0);
+    check("f64", Math.PI, -Infinity);
+    check("s128", 7, -7);
+    check("struct", 11, 22);
+    let obj = {};
+    let get_extern = instance.exports["extern" + length];
+    assertEquals(null, get_extern(0, obj));
+    assertSame(obj, get_extern(length - 1, obj));
+  }
+})();
@@ -0,0 +1,110 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+// Flags: --liftoff-loop-locals-in-registers
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testLoopWithIfElse() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addFunction('main', kSig_i_i)
+      .addLocals(kWasmI32, 2)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 2, kExprI32Const, 1, kExprI32And,
+          kExprIf, kWasmVoid,
+            kExprLocalGet, 1, kExprLocalGet, 2, kExprI32Add,
+            kExprLocalSet, 1,
+          kExprElse,
+            kExprLocalGet, 1, kExprI32Const, 3, kExprI32Sub,
+            kExprLocalSet, 1,
+          kExprEnd,
+          kExprLocalGet, 2, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 2,
+          kExprLocalGet, 0, kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertTrue(%IsLiftoffFunction(instance.exports.main));
+
+  function expected(n) {
+    let sum = 0;
+    let i = 0;
+    do {
+      sum = (i & 1) ? sum + i : sum - 3;
+      ++i;
+    } while (i < n);
+    return sum;
+  }
+  for (const n of [0, 1, 2, 7, 100]) {
+    assertEquals(expected(n), instance.exports.main(n));
+  }
+})();
+
+(function testLoopWithConstantAndFloatLocals() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addFunction('main', makeSig([kWasmI32], [kWasmF64]))
+      .addLocals(kWasmF64, 1)
+      .addLocals(kWasmI64, 1)
+      .addBody([
+        kExprI64Const, 5, kExprLocalSet, 2,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1, kExprLocalGet, 2, kExprF64SConvertI64,
+          kExprF64Add, kExprLocalSet, 1,
+          kExprLocalGet, 2, kExprI64Const, 1, kExprI64Add, kExprLocalSet, 2,
+          kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  // 5 + 6 + 7 + 8.
+  assertEquals(26, instance.exports.main(4));
+  assertEquals(5, instance.exports.main(1));
+})();
+
+(function testLoopWithManyLocals() {
+  print(arguments.callee.name);
+  const kNumLocals = 24;
+  const builder = new WasmModuleBuilder();
+  const body = [];
+  // Initialize every local to its index, so some of them are constants
+  // and some are registers when entering the loop.
+  for (let i = 1; i <= kNumLocals; ++i) {
+    body.push(kExprI32Const, i, kExprLocalSet, i);
+  }
+  body.push(kExprLoop, kWasmVoid);
+  for (let i = 1; i <= kNumLocals; ++i) {
+    body.push(kExprLocalGet, i, kExprI32Const, i, kExprI32Add,
+              kExprLocalSet, i);
+  }
+  body.push(
+      kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+      kExprBrIf, 0, kExprEnd);
+  body.push(kExprLocalGet, 1);
+  for (let i = 2; i <= kNumLocals; ++i) {
+    body.push(kExprLocalGet, i, kExprI32Add);
+  }
+  builder.addFunction('main', kSig_i_i)
+      .addLocals(kWasmI32, kNumLocals)
+      .addBody(body)
+      .exportFunc();
+  const instance = builder.instantiate();
+
+  function expected(n) {
+    const iterations = Math.max(n, 1);
+    let sum = 0;
+    for (let i = 1; i <= kNumLocals; ++i) sum += i * (iterations + 1);
+    return sum;
+  }
+  for (const n of [1, 2, 10]) {
+    assertEquals(expected(n), instance.exports.main(n));
+  }
+})();
@@ -0,0 +1,61 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-lazy-compilation --wasm-test-streaming
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Lazily compiled functions are validated on multiple threads. Independent of
+// which thread finds which error, the error of the function with the lowest
+// index must be reported.
+const num_functions = 100;
+
+function buildModule(invalid_functions = []) {
+  let builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  for (let i = 0; i < num_functions; ++i) {
+    let body = [];
+    for (let j = 0; j < 20; ++j) {
+      body.push(
+          kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add,
+          kExprI32LoadMem, 0, 0, kExprLocalSet, 1);
+    }
+    body.push(kExprLocalGet, 1);
+    if (invalid_functions.includes(i)) body.push(kExprI64Const, 0);
+    builder.addFunction('f' + i, kSig_i_ii).addBody(body).exportFunc();
+  }
+  return builder.toBuffer();
+}
+
+(function SyncValidationReportsFirstError() {
+  print(arguments.callee.name);
+  let bytes = buildModule([num_functions - 1, 7, num_functions >> 1]);
+  assertThrows(
+      () => new WebAssembly.Module(bytes), WebAssembly.CompileError,
+      /Compiling function #7:"f7" failed/);
+})();
+
+(function StreamingValidationReportsFirstError() {
+  print(arguments.callee.name);
+  let first_error;
+  let bytes = buildModule([7]);
+  try {
+    new WebAssembly.Module(bytes);
+  } catch (e) {
+    first_error = e.message.match(/failed: (.*)/)[1];
+  }
+  let escaped = first_error.replace(/[.*+?^${}()|[\]\\]/g, '\\$&');
+  bytes = buildModule([num_functions - 1, 7, num_functions >> 1]);
+  assertThrowsAsync(
+      WebAssembly.compile(bytes), WebAssembly.CompileError,
+      new RegExp(': ' + escaped + '$'));
+})();
+
+(function StreamingValidationSucceeds() {
+  print(arguments.callee.name);
+  assertPromiseResult(WebAssembly.compile(buildModule()), module => {
+    let instance = new WebAssembly.Instance(module);
+    assertEquals(0, instance.exports.f0(0, 0));
+  });
+})();
@@ -0,0 +1,161 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-invariant-code-motion.h"
+#include "src/compiler/access-builder.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopInvariantCodeMotionTest : public TypedGraphTest {
+ public:
+  LoopInvariantCodeMotionTest()
+      : TypedGraphTest(3),
+        simplified_(zone()),
+        jsgraph_(isolate(), graph(), common(), nullptr, simplified(), nullptr) {
+  }
+  ~LoopInvariantCodeMotionTest() override = default;
+
+ protected:
+  // Builds the start of a loop that is entered after a {Checkpoint}:
+  //   checkpoint -> loop -> branch(condition) -> if_true: back edge
+  //                                           -> if_false: exit
+  // The back edge and the exit are connected by {CloseLoop}.
+  void OpenLoop() {
+    Node* condition = Parameter(Type::Boolean(), 2);
+    checkpoint_ = graph()->NewNode(common()->Checkpoint(), EmptyFrameState(),
+                                   graph()->start(), graph()->start());
+    loop_ = graph()->NewNode(common()->Loop(2), graph()->start(),
+                             graph()->start());
+    effect_phi_ = graph()->NewNode(common()->EffectPhi(2), checkpoint_,
+                                   checkpoint_, loop_);
+    Node* branch = graph()->NewNode(common()->Branch(), condition, loop_);
+    if_true_ = graph()->NewNode(common()->IfTrue(), branch);
+    if_false_ = graph()->NewNode(common()->IfFalse(), branch);
+  }
+
+  void CloseLoop(Node* backedge_effect, Node* exit_effect, Node* value) {
+    loop_->ReplaceInput(1, if_true_);
+    effect_phi_->ReplaceInput(1, backedge_effect);
+    Node* zero = graph()->NewNode(common()->Int32Constant(0));
+    Node* ret = graph()->NewNode(common()->Return(), zero, value, exit_effect,
+                                 if_false_);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+  }
+
+  void HoistLoopInvariantLoads() {
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(graph(), tick_counter(), zone());
+    LoopInvariantCodeMotion(loop_tree, jsgraph(), zone())
+        .HoistLoopInvariantLoads();
+  }
+
+  Node* CheckMaps(Node* object, Node* effect, Node* control) {
+    ZoneHandleSet<Map> maps(factory()->heap_number_map());
+    return graph()->NewNode(
+        simplified()->CheckMaps(CheckMapsFlag::kNone, maps), object, effect,
+        control);
+  }
+
+  Node* LoadField(FieldAccess const& access, Node* object, Node* effect,
+                  Node* control) {
+    return graph()->NewNode(simplified()->LoadField(access), object, effect,
+                            control);
+  }
+
+  JSGraph* jsgraph() { return &jsgraph_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  Node* checkpoint_ = nullptr;
+  Node* loop_ = nullptr;
+  Node* effect_phi_ = nullptr;
+  Node* if_true_ = nullptr;
+  Node* if_false_ = nullptr;
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+  JSGraph jsgraph_;
+};
+
+TEST_F(LoopInvariantCodeMotionTest, HoistLoadFieldFromLoopHeader) {
+  Node* object = Parameter(Type::Any(), 0);
+  OpenLoop();
+  Node* load = LoadField(AccessBuilder::ForJSObjectElements(), object,
+                         effect_phi_, loop_);
+  CloseLoop(load, load, load);
+
+  HoistLoopInvariantLoads();
+
+  EXPECT_EQ(graph()->start(), NodeProperties::GetControlInput(load));
+  EXPECT_EQ(checkpoint_, NodeProperties::GetEffectInput(load));
+  EXPECT_EQ(load, NodeProperties::GetEffectInput(effect_phi_, 0));
+}
+
+TEST_F(LoopInvariantCodeMotionTest, HoistLoadFieldBehindCheckMaps) {
+  Node* object = Parameter(Type::Any(), 0);
+  OpenLoop();
+  Node* check = CheckMaps(object, effect_phi_, loop_);
+  // The load is only executed if the loop is not exited, so it may only be
+  // hoisted because the map check in front of it is hoisted as well.
+  Node* load =
+      LoadField(AccessBuilder::ForJSObjectElements(), object, check, if_true_);
+  CloseLoop(load, check, object);
+
+  HoistLoopInvariantLoads();
+
+  EXPECT_EQ(graph()->start(), NodeProperties::GetControlInput(check));
+  EXPECT_EQ(checkpoint_, NodeProperties::GetEffectInput(check));
+  EXPECT_EQ(graph()->start(), NodeProperties::GetControlInput(load));
+  EXPECT_EQ(check, NodeProperties::GetEffectInput(load));
+  EXPECT_EQ(load, NodeProperties::GetEffectInput(effect_phi_, 0));
+}
+
+TEST_F(LoopInvariantCodeMotionTest, KeepLoadFieldBehindLoopExitWithoutCheck) {
+  Node* object = Parameter(Type::Any(), 0);
+  OpenLoop();
+  Node* load = LoadField(AccessBuilder::ForJSObjectElements(), object,
+                         effect_phi_, if_true_);
+  CloseLoop(load, effect_phi_, object);
+
+  HoistLoopInvariantLoads();
+
+  EXPECT_EQ(if_true_, NodeProperties::GetControlInput(load));
+  EXPECT_EQ(effect_phi_, NodeProperties::GetEffectInput(load));
+  EXPECT_EQ(checkpoint_, NodeProperties::GetEffectInput(effect_phi_, 0));
+}
+
+TEST_F(LoopInvariantCodeMotionTest, KeepLoadFieldOfFieldStoredInLoop) {
+  Node* object = Parameter(Type::Any(), 0);
+  Node* value = Parameter(Type::Any(), 1);
+  OpenLoop();
+  Node* load_elements = LoadField(AccessBuilder::ForJSObjectElements(), object,
+                                  effect_phi_, loop_);
+  Node* load_properties =
+      LoadField(AccessBuilder::ForJSObjectPropertiesOrHash(), object,
+                load_elements, loop_);
+  Node* store = graph()->NewNode(
+      simplified()->StoreField(AccessBuilder::ForJSObjectElements()), object,
+      value, load_properties, loop_);
+  CloseLoop(store, store, load_properties);
+
+  HoistLoopInvariantLoads();
+
+  // The elements are written in the loop, the properties are not.
+  EXPECT_EQ(loop_, NodeProperties::GetControlInput(load_elements));
+  EXPECT_EQ(graph()->start(), NodeProperties::GetControlInput(load_properties));
+  EXPECT_EQ(checkpoint_, NodeProperties::GetEffectInput(load_properties));
+  EXPECT_EQ(load_properties, NodeProperties::GetEffectInput(effect_phi_, 0));
+  EXPECT_EQ(effect_phi_, NodeProperties::GetEffectInput(load_elements));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -2224,6 +2224,75 @@ TEST_P(InstructionSelectorSIMDArchShuffleTest, SIMDArchShuffle) {
 INSTANTIATE_TEST_SUITE_P(InstructionSelectorTest,
                          InstructionSelectorSIMDArchShuffleTest,
                          ::testing::ValuesIn(kArchShuffles));
+
+namespace {
+// Overrides whether the host supports {feature} for the lifetime of the scope.
+// The selection of some shuffles depends on CpuFeatures directly, since the
+// code generator checks the same.
+class CpuFeatureOverrideScope {
+ public:
+  CpuFeatureOverrideScope(CpuFeature feature, bool supported)
+      : feature_(feature), was_supported_(CpuFeatures::IsSupported(feature)) {
+    Set(supported);
+  }
+  ~CpuFeatureOverrideScope() { Set(was_supported_); }
+
+ private:
+  void Set(bool supported) {
+    if (supported) {
+      CpuFeatures::SetSupported(feature_);
+    } else {
+      CpuFeatures::SetUnsupported(feature_);
+    }
+  }
+
+  CpuFeature feature_;
+  bool was_supported_;
+};
+}  // namespace
+
+TEST_F(InstructionSelectorTest, SIMDS8x16DupWithAVX2) {
+  CpuFeatureOverrideScope avx(AVX, true);
+  CpuFeatureOverrideScope avx2(AVX2, true);
+  MachineType type = MachineType::Simd128();
+  for (uint8_t lane = 0; lane < kSimd128Size; ++lane) {
+    StreamBuilder m(this, type, type, type);
+    uint8_t shuffle[kSimd128Size];
+    for (int i = 0; i < kSimd128Size; ++i) shuffle[i] = lane;
+    Node* n = m.AddNode(m.machine()->I8x16Shuffle(shuffle), m.Parameter(0),
+                        m.Parameter(1));
+    m.Return(n);
+    Stream s = m.Build();
+    ASSERT_EQ(1U, s.size());
+    EXPECT_EQ(kX64S8x16Dup, s[0]->arch_opcode());
+    ASSERT_EQ(2U, s[0]->InputCount());
+    EXPECT_EQ(lane, s.ToInt32(s[0]->InputAt(1)));
+    // vpbroadcastb writes a separate destination register.
+    ASSERT_EQ(1U, s[0]->OutputCount());
+    EXPECT_FALSE(s.IsSameAsFirst(s[0]->Output()));
+  }
+}
+
+TEST_F(InstructionSelectorTest, SIMDS8x16DupWithoutAVX2) {
+  CpuFeatureOverrideScope avx2(AVX2, false);
+  MachineType type = MachineType::Simd128();
+  for (uint8_t lane = 0; lane < kSimd128Size; ++lane) {
+    StreamBuilder m(this, type, type, type);
+    uint8_t shuffle[kSimd128Size];
+    for (int i = 0; i < kSimd128Size; ++i) shuffle[i] = lane;
+    Node* n = m.AddNode(m.machine()->I8x16Shuffle(shuffle), m.Parameter(0),
+                        m.Parameter(1));
+    m.Return(n);
+    Stream s = m.Build();
+    ASSERT_EQ(1U, s.size());
+    EXPECT_EQ(kX64S8x16Dup, s[0]->arch_opcode());
+    ASSERT_EQ(2U, s[0]->InputCount());
+    EXPECT_EQ(lane, s.ToInt32(s[0]->InputAt(1)));
+    // The punpck/pshuf sequence works in place.
+    ASSERT_EQ(1U, s[0]->OutputCount());
+    EXPECT_TRUE(s.IsSameAsFirst(s[0]->Output()));
+  }
+}
 #endif  // V8_ENABLE_WEBASSEMBLY
 
 struct SwizzleConstants {
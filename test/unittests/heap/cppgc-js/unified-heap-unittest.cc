@@ -23,7 +23,9 @@
 #include "src/heap/cppgc-js/cpp-heap.h"
 #include "src/heap/cppgc/heap-object-header.h"
 #include "src/heap/cppgc/sweeper.h"
+#include "src/heap/embedder-tracing.h"
 #include "src/objects/objects-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/heap/cppgc-js/unified-heap-utils.h"
 #include "test/unittests/heap/heap-utils.h"
 
@@ -183,6 +185,73 @@ TEST_F(UnifiedHeapTest, TracedReferenceRetainsFromStack) {
 }
 #endif  // !V8_OS_FUCHSIA
 
+#if defined(CPPGC_YOUNG_GENERATION)
+namespace {
+
+class YoungGenerationUnifiedHeapTest : public UnifiedHeapTest {
+ public:
+  YoungGenerationUnifiedHeapTest()
+      : young_generation_scope_(&FLAG_cppgc_young_generation, true) {}
+
+  void CollectYoungGarbage() {
+    EmbedderStackStateScope stack_scope(
+        heap()->local_embedder_heap_tracer(),
+        EmbedderHeapTracer::EmbedderStackState::kNoHeapPointers);
+    CollectGarbage(NEW_SPACE);
+    cpp_heap().AsBase().sweeper().FinishIfRunning();
+  }
+
+ private:
+  FlagScope<bool> young_generation_scope_;
+};
+
+}  // namespace
+
+TEST_F(YoungGenerationUnifiedHeapTest, ScavengeCollectsYoungCppObjects) {
+  v8::HandleScope scope(v8_isolate());
+  v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+  v8::Context::Scope context_scope(context);
+  CollectGarbageWithoutEmbedderStack();
+  uint16_t wrappable_type = WrapperHelper::kTracedEmbedderId;
+  auto* wrappable = cppgc::MakeGarbageCollected<Wrappable>(allocation_handle());
+  v8::Local<v8::Object> api_object =
+      WrapperHelper::CreateWrapper(context, &wrappable_type, wrappable);
+  cppgc::MakeGarbageCollected<Wrappable>(allocation_handle());
+  Wrappable::destructor_callcount = 0;
+  CollectYoungGarbage();
+  // Only the object that is not held by a wrapper is reclaimed.
+  EXPECT_EQ(1u, Wrappable::destructor_callcount);
+  EXPECT_TRUE(
+      cppgc::internal::HeapObjectHeader::FromObject(wrappable).IsMarked());
+  EXPECT_FALSE(api_object.IsEmpty());
+}
+
+TEST_F(YoungGenerationUnifiedHeapTest, OldWrapperKeepsYoungCppObjectAlive) {
+  v8::HandleScope scope(v8_isolate());
+  v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+  v8::Context::Scope context_scope(context);
+  uint16_t wrappable_type = WrapperHelper::kTracedEmbedderId;
+  v8::Local<v8::Object> api_object = WrapperHelper::CreateWrapper(
+      context, &wrappable_type,
+      cppgc::MakeGarbageCollected<Wrappable>(allocation_handle()));
+  // Surviving two full GCs promotes the wrapper.
+  CollectGarbageWithoutEmbedderStack();
+  CollectGarbageWithoutEmbedderStack();
+  ASSERT_FALSE(Heap::InYoungGeneration(*v8::Utils::OpenHandle(*api_object)));
+  // Point the old wrapper to a young C++ object. The write goes through the
+  // API which records the reference.
+  auto* young = cppgc::MakeGarbageCollected<Wrappable>(allocation_handle());
+  WrapperHelper::SetWrappableConnection(api_object, &wrappable_type, young);
+  Wrappable::destructor_callcount = 0;
+  CollectYoungGarbage();
+  EXPECT_EQ(1u, Wrappable::destructor_callcount);
+  EXPECT_TRUE(cppgc::internal::HeapObjectHeader::FromObject(young).IsMarked());
+  WrapperHelper::ResetWrappableConnection(api_object);
+  CollectGarbageWithoutEmbedderStack();
+  EXPECT_EQ(2u, Wrappable::destructor_callcount);
+}
+#endif  // defined(CPPGC_YOUNG_GENERATION)
+
 TEST_F(UnifiedHeapDetachedTest, AllocationBeforeConfigureHeap) {
   auto heap = v8::CppHeap::Create(
       V8::GetCurrentPlatform(),
@@ -4,6 +4,8 @@
 
 #include "src/heap/cppgc/compactor.h"
 
+#include <vector>
+
 #include "include/cppgc/allocation.h"
 #include "include/cppgc/custom-space.h"
 #include "include/cppgc/persistent.h"
@@ -23,6 +25,13 @@ class CompactableCustomSpace : public CustomSpace<CompactableCustomSpace> {
   static constexpr bool kSupportsCompaction = true;
 };
 
+class OtherCompactableCustomSpace
+    : public CustomSpace<OtherCompactableCustomSpace> {
+ public:
+  static constexpr size_t kSpaceIndex = 1;
+  static constexpr bool kSupportsCompaction = true;
+};
+
 namespace internal {
 
 namespace {
@@ -41,13 +50,23 @@ struct CompactableGCed : public GarbageCollected<CompactableGCed> {
 // static
 size_t CompactableGCed::g_destructor_callcount = 0;
 
-template <int kNumObjects>
+struct OtherSpaceCompactableGCed
+    : public GarbageCollected<OtherSpaceCompactableGCed> {
+ public:
+  void Trace(Visitor* visitor) const {
+    visitor->Trace(other);
+    visitor->RegisterMovableReference(other.GetSlotForTesting());
+  }
+  Member<CompactableGCed> other;
+};
+
+template <int kNumObjects, typename T = CompactableGCed>
 struct CompactableHolder
-    : public GarbageCollected<CompactableHolder<kNumObjects>> {
+    : public GarbageCollected<CompactableHolder<kNumObjects, T>> {
  public:
   explicit CompactableHolder(cppgc::AllocationHandle& allocation_handle) {
     for (int i = 0; i < kNumObjects; ++i)
-      objects[i] = MakeGarbageCollected<CompactableGCed>(allocation_handle);
+      objects[i] = MakeGarbageCollected<T>(allocation_handle);
   }
 
   void Trace(Visitor* visitor) const {
@@ -56,7 +75,7 @@ struct CompactableHolder
       visitor->RegisterMovableReference(objects[i].GetSlotForTesting());
     }
   }
-  Member<CompactableGCed> objects[kNumObjects];
+  Member<T> objects[kNumObjects];
 };
 
 class CompactorTest : public testing::TestWithPlatform {
@@ -65,6 +84,8 @@ class CompactorTest : public testing::TestWithPlatform {
     Heap::HeapOptions options;
     options.custom_spaces.emplace_back(
         std::make_unique<CompactableCustomSpace>());
+    options.custom_spaces.emplace_back(
+        std::make_unique<OtherCompactableCustomSpace>());
     heap_ = Heap::Create(platform_, std::move(options));
   }
 
@@ -116,6 +137,11 @@ struct SpaceTrait<internal::CompactableGCed> {
   using Space = CompactableCustomSpace;
 };
 
+template <>
+struct SpaceTrait<internal::OtherSpaceCompactableGCed> {
+  using Space = OtherCompactableCustomSpace;
+};
+
 namespace internal {
 
 TEST_F(CompactorTest, NothingToCompact) {
@@ -241,5 +267,95 @@ TEST_F(CompactorTest, InteriorSlotToNextObject) {
   EXPECT_EQ(references[1], holder->objects[1]->other);
 }
 
+TEST_F(CompactorTest, CrossSpaceReferences) {
+  static constexpr int kNumObjects = 4;
+  Persistent<CompactableHolder<kNumObjects>> holder =
+      MakeGarbageCollected<CompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  Persistent<CompactableHolder<kNumObjects, OtherSpaceCompactableGCed>>
+      other_holder = MakeGarbageCollected<
+          CompactableHolder<kNumObjects, OtherSpaceCompactableGCed>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  CompactableGCed* references[kNumObjects] = {nullptr};
+  OtherSpaceCompactableGCed* other_references[kNumObjects] = {nullptr};
+  for (int i = 0; i < kNumObjects; ++i) {
+    references[i] = holder->objects[i];
+    references[i]->id = i;
+    other_references[i] = other_holder->objects[i];
+    other_references[i]->other = references[i];
+  }
+  StartGC();
+  // The first half of objects in both spaces dies. The second half of objects
+  // in the first space is only reachable from the other space.
+  for (int i = 0; i < kNumObjects; ++i) {
+    holder->objects[i] = nullptr;
+    if (i < kNumObjects / 2) other_holder->objects[i] = nullptr;
+  }
+  EndGC();
+  EXPECT_EQ(static_cast<size_t>(kNumObjects / 2),
+            CompactableGCed::g_destructor_callcount);
+  // Both spaces are compacted and references across them are updated.
+  for (int i = kNumObjects / 2; i < kNumObjects; ++i) {
+    const int new_index = i - kNumObjects / 2;
+    EXPECT_EQ(other_references[new_index], other_holder->objects[i]);
+    EXPECT_EQ(references[new_index], other_holder->objects[i]->other);
+    EXPECT_EQ(static_cast<size_t>(i), other_holder->objects[i]->other->id);
+  }
+}
+
+TEST_F(CompactorTest, OnlyFragmentedSpacesAreCompacted) {
+  // Both spaces span several pages. 7 in 8 objects in the first space die,
+  // which puts most of its pages on the free list, above the 25% needed for
+  // evacuation. That is also enough free memory to enable compaction at all.
+  // Only 1 in 8 objects in the other space die, which leaves it below the
+  // ratio, so it is not evacuated even though compaction runs.
+  static constexpr int kObjectsPerPage =
+      kPageSize / (sizeof(CompactableGCed) + sizeof(HeapObjectHeader));
+  static constexpr int kNumObjects = 8 * kObjectsPerPage;
+  static constexpr int kStride = 8;
+  Persistent<CompactableHolder<kNumObjects>> holder =
+      MakeGarbageCollected<CompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  Persistent<CompactableHolder<kNumObjects, OtherSpaceCompactableGCed>>
+      other_holder = MakeGarbageCollected<
+          CompactableHolder<kNumObjects, OtherSpaceCompactableGCed>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  CompactableGCed* const second_reference = holder->objects[1];
+  std::vector<OtherSpaceCompactableGCed*> other_references;
+  for (int i = 0; i < kNumObjects; ++i) {
+    if (i % kStride) {
+      holder->objects[i] = nullptr;
+      other_references.push_back(other_holder->objects[i]);
+    } else {
+      other_holder->objects[i] = nullptr;
+    }
+  }
+  // Sweeping the dead objects fills the free lists that compaction is based
+  // on.
+  heap()->CollectGarbage(GarbageCollector::Config::PreciseAtomicConfig());
+
+  compactor().InitializeIfShouldCompact(
+      GarbageCollector::Config::MarkingType::kIncremental,
+      GarbageCollector::Config::StackState::kNoHeapPointers);
+  EXPECT_TRUE(compactor().IsEnabledForTesting());
+  const RawHeap& raw_heap = heap()->raw_heap();
+  EXPECT_TRUE(compactor().IsCompactedSpace(*raw_heap.CustomSpace(
+      CustomSpaceIndex(CompactableCustomSpace::kSpaceIndex))));
+  EXPECT_FALSE(compactor().IsCompactedSpace(*raw_heap.CustomSpace(
+      CustomSpaceIndex(OtherCompactableCustomSpace::kSpaceIndex))));
+  heap()->StartIncrementalGarbageCollection(
+      GarbageCollector::Config::PreciseIncrementalConfig());
+  EndGC();
+
+  // Live objects of the fragmented space moved to the start of the space.
+  EXPECT_EQ(second_reference, holder->objects[kStride]);
+  // Live objects of the other space stayed in place.
+  size_t other_index = 0;
+  for (int i = 0; i < kNumObjects; ++i) {
+    if (i % kStride == 0) continue;
+    EXPECT_EQ(other_references[other_index++], other_holder->objects[i]);
+  }
+}
+
 }  // namespace internal
 }  // namespace cppgc
@@ -9,6 +9,7 @@
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/heap/gc-tracer.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -204,6 +205,43 @@ TEST_F(GCTracerTest, IncrementalScope) {
       200.0, tracer->current_.scopes[GCTracer::Scope::MC_INCREMENTAL_FINALIZE]);
 }
 
+TEST_F(GCTracerTest, AtomicPauseTarget) {
+  FlagScope<double> pause_target(&FLAG_incremental_marking_pause_target, 5);
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+
+  // An atomic pause within the target.
+  tracer->Start(GarbageCollector::MARK_COMPACTOR,
+                GarbageCollectionReason::kTesting, "collector unittest");
+  tracer->current_.type = GCTracer::Event::INCREMENTAL_MARK_COMPACTOR;
+  tracer->RecordAtomicPauseTarget(3);
+  EXPECT_EQ(0u, tracer->atomic_pause_target_misses());
+  EXPECT_DOUBLE_EQ(5.0, tracer->atomic_pause_target_);
+  EXPECT_DOUBLE_EQ(0.0, tracer->atomic_pause_target_overshoot_);
+  tracer->Stop(GarbageCollector::MARK_COMPACTOR);
+
+  // An atomic pause exceeding the target.
+  tracer->ResetForTesting();
+  tracer->Start(GarbageCollector::MARK_COMPACTOR,
+                GarbageCollectionReason::kTesting, "collector unittest");
+  tracer->current_.type = GCTracer::Event::INCREMENTAL_MARK_COMPACTOR;
+  // Pretend the atomic pause started 100ms ago.
+  tracer->current_.start_time -= 100;
+  tracer->Stop(GarbageCollector::MARK_COMPACTOR);
+  EXPECT_EQ(1u, tracer->atomic_pause_target_misses());
+  EXPECT_LE(95.0, tracer->atomic_pause_target_overshoot_);
+
+  // A following non-incremental mark-compact has no target.
+  tracer->Start(GarbageCollector::MARK_COMPACTOR,
+                GarbageCollectionReason::kTesting, "collector unittest");
+  tracer->current_.type = GCTracer::Event::MARK_COMPACTOR;
+  tracer->current_.start_time -= 100;
+  tracer->Stop(GarbageCollector::MARK_COMPACTOR);
+  EXPECT_EQ(1u, tracer->atomic_pause_target_misses());
+  EXPECT_DOUBLE_EQ(-1.0, tracer->atomic_pause_target_);
+  EXPECT_DOUBLE_EQ(-1.0, tracer->atomic_pause_target_overshoot_);
+}
+
 TEST_F(GCTracerTest, IncrementalMarkingDetails) {
   GCTracer* tracer = i_isolate()->heap()->tracer();
   tracer->ResetForTesting();
@@ -0,0 +1,63 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/incremental-marking.h"
+
+#include "src/heap/heap.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/heap/heap-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+using IncrementalMarkingTest = TestWithHeapInternals;
+
+TEST_F(IncrementalMarkingTest, PauseTargetSchedulesBytesToMark) {
+  if (!FLAG_incremental_marking) return;
+  // Without concurrent marking all work left is predicted for the pause.
+  FlagScope<bool> no_concurrent_marking(&FLAG_concurrent_marking, false);
+  FlagScope<double> pause_target(&FLAG_incremental_marking_pause_target, 0);
+  SimulateIncrementalMarking(false);
+  IncrementalMarking* marking = heap()->incremental_marking();
+  ASSERT_TRUE(marking->IsMarking());
+
+  // Pretend that a large old generation is left to mark.
+  marking->initial_old_generation_size_ = 64 * MB;
+  marking->old_generation_survival_ratio_ = 1.0;
+  marking->bytes_marked_ = 0;
+  double now = marking->pause_target_update_time_ms_;
+  const size_t scheduled_bytes = marking->scheduled_bytes_to_mark_;
+
+  // Nothing is scheduled without a target.
+  marking->ScheduleBytesToMarkBasedOnPauseTarget(now += 20);
+  EXPECT_EQ(scheduled_bytes, marking->scheduled_bytes_to_mark_);
+  EXPECT_FALSE(marking->behind_pause_target_);
+
+  // The predicted pause fits into the target.
+  const double predicted_pause_ms = marking->PredictAtomicPauseInMs();
+  FLAG_incremental_marking_pause_target = 2 * predicted_pause_ms;
+  marking->ScheduleBytesToMarkBasedOnPauseTarget(now += 20);
+  EXPECT_EQ(scheduled_bytes, marking->scheduled_bytes_to_mark_);
+  EXPECT_FALSE(marking->behind_pause_target_);
+
+  // The predicted pause exceeds the target.
+  FLAG_incremental_marking_pause_target = predicted_pause_ms / 2;
+  marking->ScheduleBytesToMarkBasedOnPauseTarget(now += 20);
+  EXPECT_LT(scheduled_bytes, marking->scheduled_bytes_to_mark_);
+  EXPECT_TRUE(marking->behind_pause_target_);
+
+  // Once the prediction is within the target again, no more bytes are
+  // scheduled.
+  const size_t scheduled_bytes_behind = marking->scheduled_bytes_to_mark_;
+  FLAG_incremental_marking_pause_target = 2 * predicted_pause_ms;
+  marking->ScheduleBytesToMarkBasedOnPauseTarget(now += 20);
+  EXPECT_EQ(scheduled_bytes_behind, marking->scheduled_bytes_to_mark_);
+  EXPECT_FALSE(marking->behind_pause_target_);
+
+  CollectGarbage(OLD_SPACE);
+}
+
+}  // namespace internal
+}  // namespace v8